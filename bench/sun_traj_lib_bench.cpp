@@ -0,0 +1,931 @@
+/*
+
+    sun_traj_lib benchmark
+    Micro-benchmarks of the trajectory classes (ns/sample and heap allocations/sample)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+/*
+    Usage: sun_traj_lib_bench [--filter=<substring>] [--min_time=<seconds>]
+    Each benchmark is repeated until it runs for at least min_time seconds (default 0.2 s),
+    the reported values are averaged over the iterations.
+    Allocations are counted by replacing the global operator new.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+
+#include "sun_traj_lib/COR_Traj.h"
+#include "sun_traj_lib/Cartesian_Traj_Batch_Evaluator.h"
+#include "sun_traj_lib/Cartesian_Independent_Traj.h"
+#include "sun_traj_lib/Double_S_Traj.h"
+#include "sun_traj_lib/Line_Segment_Traj.h"
+#include "sun_traj_lib/OTG_Traj.h"
+#include "sun_traj_lib/Position_BSpline_Traj.h"
+#include "sun_traj_lib/Position_Circumference_Traj.h"
+#include "sun_traj_lib/Position_Circumference_Traj_Cursor.h"
+#include "sun_traj_lib/Position_Traj_Cursor.h"
+#include "sun_traj_lib/Position_Traj_Sequence.h"
+#include "sun_traj_lib/Quaternion_Interp_Traj.h"
+#include "sun_traj_lib/Quaternion_Squad_Traj.h"
+#include "sun_traj_lib/Quintic_Poly_Traj.h"
+#include "sun_traj_lib/Rotation_Const_Axis_Traj.h"
+#include "sun_traj_lib/Scalar_Traj_Cursor.h"
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
+#include "sun_traj_lib/Sampled_Cartesian_Traj.h"
+#include "sun_traj_lib/Sine_Traj.h"
+#include "sun_traj_lib/Sine_Traj_Cursor.h"
+#include "sun_traj_lib/Traj_Arena.h"
+#include "sun_traj_lib/Traj_Diagnostic.h"
+#include "sun_traj_lib/Trapez_Traj.h"
+#include "sun_traj_lib/Trapez_Vel_Traj.h"
+#include "sun_traj_lib/Vector_Independent_Traj.h"
+#include "sun_traj_lib/Vector_OTG_Traj.h"
+#include "sun_traj_lib/Vector_Quintic_Poly_Traj.h"
+
+using namespace TooN;
+using namespace sun;
+
+/*====== ALLOCATION COUNTER =========*/
+
+static std::atomic<uint64_t> g_alloc_count(0);
+
+void* operator new(std::size_t size)
+{
+  g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+/*====== HARNESS =========*/
+
+static std::string g_filter;
+static double g_min_time = 0.2;
+
+/*
+    Prevent the compiler from optimizing away value
+*/
+template <class T>
+inline void doNotOptimize(const T& value)
+{
+  asm volatile("" : : "m"(value) : "memory");
+}
+
+/*
+    Run op(i) for i = 0,1,... until min_time is reached and print the timing
+*/
+template <class Op>
+void runBench(const std::string& name, Op&& op)
+{
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos)
+    return;
+
+  int64_t iterations = 1;
+  while (true)
+  {
+    uint64_t allocs_start = g_alloc_count.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < iterations; i++)
+    {
+      op(i);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    uint64_t allocs = g_alloc_count.load(std::memory_order_relaxed) - allocs_start;
+    double elapsed = std::chrono::duration<double>(stop - start).count();
+
+    if (elapsed >= g_min_time || iterations >= (int64_t(1) << 32))
+    {
+      printf("%-56s %12.2f %14.3f %14lld\n", name.c_str(), 1.0e9 * elapsed / iterations,
+             double(allocs) / iterations, (long long)iterations);
+      return;
+    }
+
+    double factor = elapsed > 0.0 ? 1.4 * g_min_time / elapsed : 100.0;
+    if (factor < 2.0)
+      factor = 2.0;
+    if (factor > 100.0)
+      factor = 100.0;
+    iterations = int64_t(iterations * factor);
+  }
+}
+
+/*
+    Time at iteration i, sweeping the traj in 1024 steps
+*/
+inline double sweepTime(const Traj_Generator_Interface& traj, int64_t i)
+{
+  return traj.getInitialTime() + (i & 1023) * (traj.getDuration() / 1023.0);
+}
+
+/*
+    Benchmark the scalar traj getters, construction (by make) and clone
+*/
+template <class Traj, class Make>
+void benchScalar(const std::string& name, Make&& make)
+{
+  const Traj traj = make();
+  runBench(name + "/getPosition", [&](int64_t i) { doNotOptimize(traj.getPosition(sweepTime(traj, i))); });
+  runBench(name + "/getVelocity", [&](int64_t i) { doNotOptimize(traj.getVelocity(sweepTime(traj, i))); });
+  runBench(name + "/getAcceleration", [&](int64_t i) { doNotOptimize(traj.getAcceleration(sweepTime(traj, i))); });
+  runBench(name + "/getState", [&](int64_t i) { doNotOptimize(traj.getState(sweepTime(traj, i))); });
+  Scalar_Traj_Cursor_Ptr cursor(traj.createCursor(traj.getInitialTime()));
+  runBench(name + "/cursor.advance", [&](int64_t i) {
+    // same sweep of sweepTime(), streamed
+    if ((i & 1023) == 0)
+      cursor->seek(traj.getInitialTime());
+    else
+      cursor->advance(traj.getDuration() / 1023.0);
+    doNotOptimize(cursor->getState());
+  });
+  runBench(name + "/construct", [&](int64_t) {
+    Traj t = make();
+    doNotOptimize(t);
+  });
+  runBench(name + "/clone", [&](int64_t) {
+    Scalar_Traj_Interface_Ptr t(traj.clone());
+    doNotOptimize(t);
+  });
+}
+
+/*
+    Benchmark the position traj getters, construction (by make) and clone
+*/
+template <class Traj, class Make>
+void benchPosition(const std::string& name, Make&& make)
+{
+  const Traj traj = make();
+  runBench(name + "/getPosition", [&](int64_t i) { doNotOptimize(traj.getPosition(sweepTime(traj, i))); });
+  runBench(name + "/getVelocity", [&](int64_t i) { doNotOptimize(traj.getVelocity(sweepTime(traj, i))); });
+  runBench(name + "/getAcceleration", [&](int64_t i) { doNotOptimize(traj.getAcceleration(sweepTime(traj, i))); });
+  Position_Traj_Cursor_Ptr cursor(traj.createCursor(traj.getInitialTime()));
+  runBench(name + "/cursor.advance", [&](int64_t i) {
+    // same sweep of sweepTime(), streamed (position, velocity and acceleration)
+    if ((i & 1023) == 0)
+      cursor->seek(traj.getInitialTime());
+    else
+      cursor->advance(traj.getDuration() / 1023.0);
+    doNotOptimize(cursor->getAcceleration());
+  });
+  runBench(name + "/construct", [&](int64_t) {
+    Traj t = make();
+    doNotOptimize(t);
+  });
+  runBench(name + "/clone", [&](int64_t) {
+    Position_Traj_Interface_Ptr t(traj.clone());
+    doNotOptimize(t);
+  });
+}
+
+/*
+    Benchmark the quaternion traj getters, construction (by make) and clone
+*/
+template <class Traj, class Make>
+void benchQuaternion(const std::string& name, Make&& make)
+{
+  const Traj traj = make();
+  runBench(name + "/getQuaternion", [&](int64_t i) { doNotOptimize(traj.getQuaternion(sweepTime(traj, i))); });
+  runBench(name + "/getVelocity", [&](int64_t i) { doNotOptimize(traj.getVelocity(sweepTime(traj, i))); });
+  runBench(name + "/getAcceleration", [&](int64_t i) { doNotOptimize(traj.getAcceleration(sweepTime(traj, i))); });
+  runBench(name + "/construct", [&](int64_t) {
+    Traj t = make();
+    doNotOptimize(t);
+  });
+  runBench(name + "/clone", [&](int64_t) {
+    Quaternion_Traj_Interface_Ptr t(traj.clone());
+    doNotOptimize(t);
+  });
+}
+
+/*
+    Benchmark the cartesian traj getters, construction (by make) and clone
+*/
+template <class Traj, class Make>
+void benchCartesian(const std::string& name, Make&& make)
+{
+  const Traj traj = make();
+  runBench(name + "/getPosition", [&](int64_t i) { doNotOptimize(traj.getPosition(sweepTime(traj, i))); });
+  runBench(name + "/getQuaternion", [&](int64_t i) { doNotOptimize(traj.getQuaternion(sweepTime(traj, i))); });
+  runBench(name + "/getTwist", [&](int64_t i) { doNotOptimize(traj.getTwist(sweepTime(traj, i))); });
+  runBench(name + "/construct", [&](int64_t) {
+    Traj t = make();
+    doNotOptimize(t);
+  });
+  runBench(name + "/clone", [&](int64_t) {
+    Cartesian_Traj_Interface_Ptr t(traj.clone());
+    doNotOptimize(t);
+  });
+  Traj_Arena arena(1 << 16);
+  runBench(name + "/clone(arena)", [&](int64_t) {
+    {
+      Traj_Arena_Unique_Ptr<Cartesian_Traj_Interface> t(arena.clone(traj));
+      doNotOptimize(t);
+    }
+    arena.reset();
+  });
+}
+
+/*
+    Benchmark the vector traj getters, construction (by make) and clone
+*/
+template <class Traj, class Make>
+void benchVector(const std::string& name, Make&& make)
+{
+  const Traj traj = make();
+  runBench(name + "/getPosition", [&](int64_t i) { doNotOptimize(traj.getPosition(sweepTime(traj, i))); });
+  runBench(name + "/getVelocity", [&](int64_t i) { doNotOptimize(traj.getVelocity(sweepTime(traj, i))); });
+  runBench(name + "/getAcceleration", [&](int64_t i) { doNotOptimize(traj.getAcceleration(sweepTime(traj, i))); });
+  int dim = traj.getPosition(traj.getInitialTime()).size();
+  Vector<> pos(dim), vel(dim), acc(dim);
+  runBench(name + "/getState(no alloc)", [&](int64_t i) {
+    traj.getStateInto(sweepTime(traj, i), pos, vel, acc);
+    doNotOptimize(pos[0]);
+  });
+  runBench(name + "/construct", [&](int64_t) {
+    Traj t = make();
+    doNotOptimize(t);
+  });
+  runBench(name + "/clone", [&](int64_t) {
+    Vector_Traj_Interface_Ptr t(traj.clone());
+    doNotOptimize(t);
+  });
+  Traj_Arena arena(1 << 16);
+  runBench(name + "/clone(arena)", [&](int64_t) {
+    {
+      Traj_Arena_Unique_Ptr<Vector_Traj_Interface> t(arena.clone(traj));
+      doNotOptimize(t);
+    }
+    arena.reset();
+  });
+}
+
+/*====== TRAJS UNDER TEST =========*/
+
+static Quintic_Poly_Traj makeQuintic()
+{
+  return Quintic_Poly_Traj(2.0, 0.0, 1.0, 0.5, 0.1, -0.1);
+}
+
+static Trapez_Traj makeTrapez()
+{
+  return Trapez_Traj(2.0, 0.0, 1.0, 0.75, 0.5);
+}
+
+static Trapez_Vel_Traj makeTrapezVel()
+{
+  return Trapez_Vel_Traj(1.0, 1.0, 2.0, 0.0, 0.5);
+}
+
+static Double_S_Traj makeDoubleS()
+{
+  return Double_S_Traj(0.0, 1.0, 1.0, 2.0, 10.0, 0.5);
+}
+
+static Sine_Traj makeSine()
+{
+  return Sine_Traj(2.0, 1.0, 1.0, 0.0, 0.0, 0.5);
+}
+
+static Line_Segment_Traj makeLineSegment()
+{
+  return Line_Segment_Traj(makeVector(0.0, 0.0, 0.0), makeVector(1.0, 2.0, 3.0), makeQuintic());
+}
+
+static Position_Circumference_Traj makeCircumference()
+{
+  return Position_Circumference_Traj(makeVector(0.0, 0.0, 1.0), makeVector(0.0, 0.0, 0.0), makeVector(1.0, 0.0, 0.0),
+                                     Quintic_Poly_Traj(2.0, 0.0, M_PI, 0.5));
+}
+
+static Rotation_Const_Axis_Traj makeRotationConstAxis()
+{
+  return Rotation_Const_Axis_Traj(UnitQuaternion(), makeVector(0.0, 0.0, 1.0), Quintic_Poly_Traj(2.0, 0.0, M_PI, 0.5));
+}
+
+static Quaternion_Interp_Traj makeQuaternionInterp()
+{
+  return Quaternion_Interp_Traj(UnitQuaternion(), UnitQuaternion::angvec(M_PI, makeVector(0.0, 0.0, 1.0)),
+                                Quintic_Poly_Traj(2.0, 0.0, 1.0, 0.5));
+}
+
+static Quaternion_Squad_Traj makeQuaternionSquad()
+{
+  std::vector<UnitQuaternion> waypoints;
+  for (int i = 0; i < 5; i++)
+  {
+    waypoints.push_back(UnitQuaternion::angvec(0.5 * i, makeVector(sin(i), cos(i), 1.0)));
+  }
+  return Quaternion_Squad_Traj(waypoints, Quintic_Poly_Traj(2.0, 0.0, 4.0, 0.5));
+}
+
+static Cartesian_Independent_Traj makeCartesianIndependent()
+{
+  return Cartesian_Independent_Traj(makeLineSegment(), makeRotationConstAxis());
+}
+
+static COR_Traj makeCOR()
+{
+  return COR_Traj(makeVector(0.0, 0.0, 0.0), makeVector(0.0, 0.0, 1.0), makeVector(1.0, 0.0, 0.0), UnitQuaternion(),
+                  Quintic_Poly_Traj(2.0, 0.0, M_PI, 0.5));
+}
+
+static Vector_Independent_Traj makeVectorIndependent()
+{
+  return Vector_Independent_Traj(makeQuintic(), 7);
+}
+
+static Vector_Quintic_Poly_Traj makeVectorQuintic()
+{
+  return Vector_Quintic_Poly_Traj(2.0, Vector<>(Zeros(7)), Vector<>(Ones(7)), 0.5);
+}
+
+/*
+    Cubic B-spline through n waypoints on a helix
+*/
+static Position_BSpline_Traj makeBSpline(int n)
+{
+  std::vector<Vector<3> > waypoints;
+  for (int i = 0; i < n; i++)
+  {
+    const double angle = 0.1 * i;
+    waypoints.push_back(makeVector(cos(angle), sin(angle), 0.01 * i));
+  }
+  return Position_BSpline_Traj(waypoints, Quintic_Poly_Traj(2.0, 0.0, 1.0, 0.5));
+}
+
+static Position_BSpline_Traj makeBSpline1000()
+{
+  return makeBSpline(1000);
+}
+
+/*
+    Zig-zag path of 500 line segments of 0.1s each
+*/
+static Position_Traj_Sequence makeLineSegmentSequence()
+{
+  Position_Traj_Sequence sequence;
+  for (int i = 0; i < 500; i++)
+  {
+    double t0 = 0.1 * i;
+    sequence.push_back_traj(Line_Segment_Traj(makeVector(double(i), double(i % 2), 0.0),
+                                              makeVector(double(i + 1), double((i + 1) % 2), 0.0),
+                                              Quintic_Poly_Traj(0.1, 0.0, 1.0, t0)));
+  }
+  return sequence;
+}
+
+/*
+    Zig-zag path of 100 waypoints with circular blends (createBlended)
+*/
+static Position_Traj_Sequence makeBlendedSequence()
+{
+  std::vector<Vector<3> > waypoints;
+  for (int i = 0; i < 100; i++)
+  {
+    waypoints.push_back(makeVector(double(i), double(i % 2), 0.0));
+  }
+  return Position_Traj_Sequence::createBlended(waypoints, 0.2, 1.0, 10.0).value();
+}
+
+/*====== RECURRENCE MODE =========*/
+
+/*
+    Benchmark the getters of a Scalar_Traj_Variant holding a copy of traj (static dispatch)
+*/
+template <class Make>
+void benchVariant(const std::string& name, Make&& make)
+{
+  const Scalar_Traj_Variant traj(make());
+  runBench(name + "/getPosition", [&](int64_t i) {
+    doNotOptimize(traj.getPosition(traj.getInitialTime() + (i & 1023) * (traj.getDuration() / 1023.0)));
+  });
+  runBench(name + "/getState", [&](int64_t i) {
+    doNotOptimize(traj.getState(traj.getInitialTime() + (i & 1023) * (traj.getDuration() / 1023.0)));
+  });
+}
+
+/*
+    Angular velocity and acceleration of the squad traj at time secs from central differences of getQuaternionAt()
+    (step h of s, 3 samples of squad), the numerical reference for the exact derivatives of getVelocity()
+*/
+static void squadCentralDifferences(const Quaternion_Squad_Traj& squad, const Scalar_Traj_Interface& traj_s,
+                                    double secs, double h, Vector<3>& velocity, Vector<3>& acceleration)
+{
+  const Scalar_Traj_State s = traj_s.getState(secs);
+  const UnitQuaternion q = squad.getQuaternionAt(s.position);
+  const UnitQuaternion q_plus = squad.getQuaternionAt(s.position + h);
+  const UnitQuaternion q_minus = squad.getQuaternionAt(s.position - h);
+  const double dq_s = (q_plus.getS() - q_minus.getS()) / (2.0 * h);
+  const Vector<3> dq_v = (q_plus.getV() - q_minus.getV()) / (2.0 * h);
+  const double ddq_s = (q_plus.getS() - 2.0 * q.getS() + q_minus.getS()) / (h * h);
+  const Vector<3> ddq_v = (q_plus.getV() - 2.0 * q.getV() + q_minus.getV()) / (h * h);
+  // w = 2 vec(dq/dt q*)
+  auto twiceVec = [&](double x_s, const Vector<3>& x_v) -> Vector<3> {
+    return 2.0 * (q.getS() * x_v - x_s * q.getV() - (x_v ^ q.getV()));
+  };
+  velocity = s.velocity * twiceVec(dq_s, dq_v);
+  acceleration = twiceVec(s.velocity * s.velocity * ddq_s + s.acceleration * dq_s,
+                          s.velocity * s.velocity * ddq_v + s.acceleration * dq_v);
+}
+
+/*
+    Exact derivatives of the squad traj vs central differences: timing and max difference
+*/
+static void benchSquadDerivatives()
+{
+  const Quaternion_Squad_Traj squad = makeQuaternionSquad();
+  const Quintic_Poly_Traj traj_s(2.0, 0.0, 4.0, 0.5);
+  runBench("Quaternion_Squad_Traj(5)/getVelocity(central differences)", [&](int64_t i) {
+    Vector<3> velocity, acceleration;
+    squadCentralDifferences(squad, traj_s, sweepTime(squad, i), 1.0e-4, velocity, acceleration);
+    doNotOptimize(velocity);
+  });
+
+  const std::string name = "Quaternion_Squad_Traj/error";
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos)
+    return;
+
+  printf("\n%-56s %14s %14s\n", "Squad exact - central differences (20000 samples)", "max err / max", "max err / max");
+  printf("%-56s %14s %14s\n", "", "velocity", "acceleration");
+  const double steps[] = { 1.0e-3, 1.0e-4, 1.0e-5 };
+  for (double h : steps)
+  {
+    double max_velocity = 0.0, max_acceleration = 0.0, err_velocity = 0.0, err_acceleration = 0.0;
+    for (int i = 0; i < 20000; i++)
+    {
+      const double t = squad.getInitialTime() + squad.getDuration() * i / 20000.0;
+      const double s = traj_s.getPosition(t);
+      if (fabs(s - floor(s + 0.5)) < 2.0 * h)
+        continue;  // the acceleration is discontinuous at the waypoints
+      Vector<3> velocity, acceleration;
+      squadCentralDifferences(squad, traj_s, t, h, velocity, acceleration);
+      max_velocity = std::max(max_velocity, double(norm(velocity)));
+      max_acceleration = std::max(max_acceleration, double(norm(acceleration)));
+      err_velocity = std::max(err_velocity, double(norm(squad.getVelocity(t) - velocity)));
+      err_acceleration = std::max(err_acceleration, double(norm(squad.getAcceleration(t) - acceleration)));
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "step h = %.0e", h);
+    printf("%-56s %14.3e %14.3e\n", label, err_velocity / max_velocity, err_acceleration / max_acceleration);
+  }
+}
+
+/*
+    Benchmark advance() of the Sine and Circumference cursors in recurrence mode
+*/
+static void benchRecurrence()
+{
+  const double dt = 0.001;
+  const Sine_Traj sine = makeSine();
+  Sine_Traj_Cursor sine_cursor(sine.getInitialTime(), sine.getFinalTime(), 1.0, 2.0 * M_PI, 0.0, 0.0,
+                               sine.getInitialTime());
+  sine_cursor.setRecurrence(true);
+  runBench("Sine_Traj/cursor.advance(recurrence)", [&](int64_t i) {
+    if ((i & 1023) == 0)
+      sine_cursor.seek(sine.getInitialTime());
+    else
+      sine_cursor.advance(dt);
+    doNotOptimize(sine_cursor.getState());
+  });
+
+  const Position_Circumference_Traj circumference = makeCircumference();
+  Position_Traj_Cursor_Ptr cursor(circumference.createCursor(circumference.getInitialTime()));
+  static_cast<Position_Circumference_Traj_Cursor&>(*cursor).setRecurrence(true);
+  runBench("Position_Circumference_Traj/cursor.advance(recurrence)", [&](int64_t i) {
+    if ((i & 1023) == 0)
+      cursor->seek(circumference.getInitialTime());
+    else
+      cursor->advance(circumference.getDuration() / 1023.0);
+    doNotOptimize(cursor->getAcceleration());
+  });
+}
+
+/*
+    Max error of the recurrence mode w.r.t. the closed form: 1e6 ticks at 1 kHz
+*/
+static void reportRecurrenceError()
+{
+  const std::string name = "recurrence/error";
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos)
+    return;
+
+  const double dt = 0.001;
+  const int ticks = 1000000;
+  const int resync_periods[] = { 0, 10000, 1000, 100 };
+
+  printf("\n%-56s %14s %14s\n", "Recurrence error (1e6 ticks, dt=1ms)", "max |dp|/A", "max |dv|/(wA)");
+  for (int resync_period : resync_periods)
+  {
+    // 1 Hz sine, 1000 s
+    const Sine_Traj sine(ticks * dt, 1.0, 1.0);
+    Sine_Traj_Cursor cursor(sine.getInitialTime(), sine.getFinalTime(), 1.0, 2.0 * M_PI, 0.0, 0.0, 0.0);
+    cursor.setRecurrence(true, resync_period);
+    double err_p = 0.0, err_v = 0.0;
+    for (int i = 0; i < ticks; i++)
+    {
+      cursor.advance(dt);
+      err_p = std::max(err_p, fabs(cursor.getPosition() - sine.getPosition(cursor.getTime())));
+      err_v = std::max(err_v, fabs(cursor.getVelocity() - sine.getVelocity(cursor.getTime())) / (2.0 * M_PI));
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "Sine_Traj 1Hz (resync %d)", resync_period);
+    printf("%-56s %14.3e %14.3e\n", label, err_p, err_v);
+  }
+  for (int resync_period : resync_periods)
+  {
+    // 500 turns along a quintic angular profile, 1000 s
+    const Position_Circumference_Traj circumference(makeVector(0.0, 0.0, 1.0), makeVector(0.0, 0.0, 0.0),
+                                                    makeVector(1.0, 0.0, 0.0),
+                                                    Quintic_Poly_Traj(ticks * dt, 0.0, 1000.0 * M_PI));
+    Position_Traj_Cursor_Ptr cursor(circumference.createCursor(0.0));
+    static_cast<Position_Circumference_Traj_Cursor&>(*cursor).setRecurrence(true, resync_period);
+    double err_p = 0.0, err_v = 0.0;
+    for (int i = 0; i < ticks; i++)
+    {
+      cursor->advance(dt);
+      double t = cursor->getTime();
+      err_p = std::max(err_p, double(norm(cursor->getPosition() - circumference.getPosition(t))));
+      Vector<3> v = circumference.getVelocity(t);
+      if (norm(v) > 1e-3)
+        err_v = std::max(err_v, double(norm(cursor->getVelocity() - v) / norm(v)));
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "Position_Circumference_Traj r=1 (resync %d)", resync_period);
+    printf("%-56s %14.3e %14.3e\n", label, err_p, err_v);
+  }
+}
+
+/*
+    Parallel scaling of Cartesian_Traj_Batch_Evaluator (1000 trajs x 200 times, COR and Cartesian_Independent)
+*/
+static void benchBatchEvaluator()
+{
+  const std::string name = "Cartesian_Traj_Batch_Evaluator(1000x200)";
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos)
+    return;
+
+  std::vector<Cartesian_Traj_Interface_Ptr> trajs;
+  for (int i = 0; i < 1000; i++)
+  {
+    if (i % 2)
+      trajs.emplace_back(new COR_Traj(makeCOR()));
+    else
+      trajs.emplace_back(new Cartesian_Independent_Traj(makeCartesianIndependent()));
+  }
+  std::vector<double> times;
+  for (int j = 0; j < 200; j++)
+  {
+    times.push_back(j * trajs[0]->getDuration() / 199.0);
+  }
+  Cartesian_Traj_Samples samples(trajs.size(), times.size());
+  const double num_samples = double(trajs.size() * times.size());
+
+  unsigned int max_threads = std::thread::hardware_concurrency();
+  if (max_threads == 0)
+    max_threads = 1;
+
+  printf("\n%-56s %12s %14s\n", (name + " threads").c_str(), "ns/sample", "speedup");
+  double ns_1_thread = 0.0;
+  for (unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+  {
+    Cartesian_Traj_Batch_Evaluator evaluator(num_threads);
+    evaluator.evaluate(trajs, times, samples);  // warm up
+    int64_t iterations = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    while (elapsed < g_min_time)
+    {
+      evaluator.evaluate(trajs, times, samples);
+      iterations++;
+      elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    double ns = 1.0e9 * elapsed / (iterations * num_samples);
+    if (num_threads == 1)
+      ns_1_thread = ns;
+    printf("%-56u %12.2f %14.2f\n", num_threads, ns, ns_1_thread / ns);
+    if (num_threads < max_threads && 2 * num_threads > max_threads)
+      num_threads = max_threads / 2;  // last step at max_threads
+  }
+}
+
+/*====== ONLINE TRAJECTORY GENERATION =========*/
+
+/*
+    Pseudo random number in [-1, 1) from the index i
+*/
+static double hashUniform(uint32_t i)
+{
+  uint32_t r = i * 2654435761u;
+  r ^= r >> 15;
+  r *= 2246822519u;
+  r ^= r >> 13;
+  return (r >> 8) / double(1 << 23) - 1.0;
+}
+
+/*
+    OTG: mean time of a replan from a random state and worst-case latency of the 1 kHz replan loop
+    (7 joints, a new random target at each cycle)
+*/
+static void benchOTG()
+{
+  runBench("OTG_Traj/construct(random state)", [&](int64_t i) {
+    uint32_t k = uint32_t(i) * 5u;
+    doNotOptimize(OTG_Traj(5.0 * hashUniform(k), 3.0 * hashUniform(k + 1), 5.0 * hashUniform(k + 2),
+                           1.0 + 0.5 * hashUniform(k + 3), 2.0 + hashUniform(k + 4)));
+  });
+
+  const int n = 7;
+  Vector<> target(Zeros(n)), pos(Zeros(n)), vel(Zeros(n)), acc(Zeros(n));
+  const Vector<> max_velocity(Ones(n)), max_acceleration(2.0 * Ones(n));
+  Vector_OTG_Traj traj(Vector<>(Zeros(n)), Vector<>(Zeros(n)), target, max_velocity, max_acceleration);
+  runBench("Vector_OTG_Traj(7)/replan+getState", [&](int64_t i) {
+    double secs = 0.001 * i;
+    for (int j = 0; j < n; j++)
+    {
+      target[j] = hashUniform(uint32_t(i * n + j));
+    }
+    traj.replan(secs, target);
+    traj.getStateInto(secs + 0.001, pos, vel, acc);
+    doNotOptimize(pos[0]);
+  });
+
+  const std::string name = "Vector_OTG_Traj(7)/replan latency";
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos)
+    return;
+
+  const int cycles = 100000;
+  std::vector<double> latency(cycles);
+  for (int c = 0; c < cycles; c++)
+  {
+    double secs = 0.001 * c;
+    for (int j = 0; j < n; j++)
+    {
+      target[j] = 3.0 * hashUniform(uint32_t(c * n + j + 12345));
+    }
+    auto start = std::chrono::steady_clock::now();
+    traj.replan(secs, target);
+    traj.getStateInto(secs + 0.001, pos, vel, acc);
+    auto stop = std::chrono::steady_clock::now();
+    doNotOptimize(pos[0]);
+    latency[c] = std::chrono::duration<double, std::nano>(stop - start).count();
+  }
+  std::sort(latency.begin(), latency.end());
+  printf("\n%-56s %12s %12s %12s %12s\n", (name + " (1e5 cycles)").c_str(), "p50 ns", "p99 ns", "p99.9 ns",
+         "max ns");
+  printf("%-56s %12.0f %12.0f %12.0f %12.0f\n", "replan + getState", latency[cycles / 2],
+         latency[cycles * 99 / 100], latency[cycles * 999 / 1000], latency[cycles - 1]);
+}
+
+/*====== B-SPLINE ARC LENGTH =========*/
+
+/*
+    Max error of the arc length parameterization of Position_BSpline_Traj:
+    the speed (central difference of getPosition) w.r.t. getLength()*ds/dt and getVelocity w.r.t. the central difference
+    (20000 samples, s is a quintic from 0 to 1 in 1 s)
+*/
+static void reportBSplineError()
+{
+  const std::string name = "Position_BSpline_Traj/error";
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos)
+    return;
+
+  std::vector<Vector<3> > random_waypoints, jagged_waypoints;
+  for (int i = 0; i < 50; i++)
+  {
+    random_waypoints.push_back(makeVector(hashUniform(3 * i), hashUniform(3 * i + 1), hashUniform(3 * i + 2)));
+  }
+  for (int i = 0; i < 12; i++)
+  {
+    jagged_waypoints.push_back(makeVector(0.1 * i, (i % 2) ? 1.0 : -1.0, 0.05 * (i % 3)));
+  }
+
+  printf("\n%-56s %14s %14s\n", "B-spline arc length error (20000 samples)", "max |dv|/v", "max |dv|/v");
+  printf("%-56s %14s %14s\n", "", "speed", "getVelocity");
+  const Quintic_Poly_Traj traj_s(1.0, 0.0, 1.0);
+  for (int k = 0; k < 4; k++)
+  {
+    const bool jagged = (k >= 2);
+    const int degree = (k % 2) ? 5 : 3;
+    const Position_BSpline_Traj spline(jagged ? jagged_waypoints : random_waypoints, traj_s, degree);
+    const double h = 1e-8;
+    double err_speed = 0.0, err_velocity = 0.0;
+    for (int i = 1; i < 20000; i++)
+    {
+      const double t = 0.05 + 0.9 * i / 20000.0;
+      const Vector<3> velocity = (spline.getPosition(t + h) - spline.getPosition(t - h)) / (2.0 * h);
+      const double speed = spline.getLength() * traj_s.getVelocity(t);
+      err_speed = std::max(err_speed, fabs(norm(velocity) - speed) / speed);
+      err_velocity = std::max(err_velocity, double(norm(spline.getVelocity(t) - velocity)) / speed);
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "%s, degree %d", jagged ? "jagged 12 waypoints" : "random 50 waypoints", degree);
+    printf("%-56s %14.3e %14.3e\n", label, err_speed, err_velocity);
+  }
+}
+
+/*
+    Count the calls of the fatal handler instead of exiting
+*/
+static int g_fatal_count = 0;
+
+static void countFatal(const char*)
+{
+  g_fatal_count++;
+}
+
+/*
+    Check createSynchronized() on acceleration-bound inputs (A / sqrt(A) can be one ulp above sqrt(A))
+*/
+static void reportSynchronizedCheck()
+{
+  const std::string name = "Vector_Independent_Traj/createSynchronized/check";
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos)
+    return;
+
+  Traj_Null_Sink null_sink;
+  Traj_Diagnostic_Sink* sink = getTrajDiagnosticSink();
+  setTrajDiagnosticSink(&null_sink);
+  setTrajFatalHandler(countFatal);
+  g_fatal_count = 0;
+  const Vector<2> max_velocity = makeVector(1000.0, 1000.0);
+  const Vector<2> max_acceleration = makeVector(1.0, 1.0);
+  int failures = 0;
+  const int samples = 100000;
+  for (int i = 0; i < samples; i++)
+  {
+    // the first sample is a known case with A / sqrt(A) > sqrt(A)
+    const double h = (i == 0) ? 68.41113232198953 : 100.0 * hashUniform(i);
+    const Vector<2> initial_position = makeVector(0.0, 0.0);
+    const Vector<2> final_position = makeVector(h, 1.0);
+    auto result = Vector_Independent_Traj::createSynchronized(initial_position, final_position, max_velocity,
+                                                              max_acceleration);
+    if (!result.ok())
+    {
+      failures++;
+      continue;
+    }
+    const Vector_Independent_Traj& traj = result.value();
+    const Vector<> position = traj.getPosition(traj.getFinalTime());
+    // acceleration-bound: the acceleration phase is half of the duration
+    const Vector<> acceleration = traj.getAcceleration(traj.getInitialTime() + 0.25 * traj.getDuration());
+    if (fabs(position[0] - h) > 1.0e-9 * std::max(h, 1.0) || fabs(position[1] - 1.0) > 1.0e-9 ||
+        fabs(acceleration[0]) > max_acceleration[0] * (1.0 + 1.0e-9))
+    {
+      failures++;
+    }
+  }
+  setTrajFatalHandler(nullptr);
+  setTrajDiagnosticSink(sink);
+
+  printf("\n%-56s %14s %14s\n", "createSynchronized acceleration-bound", "fatal errors", "failures");
+  printf("%-56s %14d %14d\n", "100000 random distances", g_fatal_count, failures);
+}
+
+/*====== MAIN =========*/
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strncmp(argv[i], "--filter=", 9) == 0)
+    {
+      g_filter = argv[i] + 9;
+    }
+    else if (strncmp(argv[i], "--min_time=", 11) == 0)
+    {
+      g_min_time = atof(argv[i] + 11);
+    }
+    else
+    {
+      printf("Usage: %s [--filter=<substring>] [--min_time=<seconds>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  printf("%-56s %12s %14s %14s\n", "Benchmark", "ns/sample", "allocs/sample", "Iterations");
+  printf("%s\n", std::string(99, '-').c_str());
+
+  benchScalar<Quintic_Poly_Traj>("Quintic_Poly_Traj", makeQuintic);
+  benchScalar<Trapez_Traj>("Trapez_Traj", makeTrapez);
+  benchScalar<Trapez_Vel_Traj>("Trapez_Vel_Traj", makeTrapezVel);
+  benchScalar<Double_S_Traj>("Double_S_Traj", makeDoubleS);
+  benchScalar<Sine_Traj>("Sine_Traj", makeSine);
+  benchVariant("Scalar_Traj_Variant(Quintic_Poly_Traj)", makeQuintic);
+  benchVariant("Scalar_Traj_Variant(Trapez_Traj)", makeTrapez);
+
+  benchPosition<Line_Segment_Traj>("Line_Segment_Traj", makeLineSegment);
+  benchPosition<Position_Circumference_Traj>("Position_Circumference_Traj", makeCircumference);
+  benchRecurrence();
+  benchPosition<Position_BSpline_Traj>("Position_BSpline_Traj(1000)", makeBSpline1000);
+  {
+    // the cost of a sample does not depend on the number of waypoints
+    const Position_BSpline_Traj spline = makeBSpline(20000);
+    runBench("Position_BSpline_Traj(20000)/getPosition", [&](int64_t i) {
+      doNotOptimize(spline.getPosition(0.5 + 2.0 * (i % 4096) / 4096.0));
+    });
+  }
+  benchPosition<Position_Traj_Sequence>("Position_Traj_Sequence(500)", makeLineSegmentSequence);
+  {
+    // random (non monotonic) queries defeat the segment hint: binary search
+    const Position_Traj_Sequence sequence = makeLineSegmentSequence();
+    runBench("Position_Traj_Sequence(500)/getPosition(random)", [&](int64_t i) {
+      uint32_t r = uint32_t(i) * 2654435761u;
+      doNotOptimize(sequence.getPosition(sequence.getDuration() * (r >> 8) / double(1 << 24)));
+    });
+  }
+
+  benchPosition<Position_Traj_Sequence>("Position_Traj_Sequence(blended 100)", makeBlendedSequence);
+
+  benchQuaternion<Rotation_Const_Axis_Traj>("Rotation_Const_Axis_Traj", makeRotationConstAxis);
+  {
+    // one batch of 64 samples every 64 iterations -> the time is per sample
+    const Rotation_Const_Axis_Traj rotation = makeRotationConstAxis();
+    double secs[64];
+    UnitQuaternion quats[64];
+    for (int k = 0; k < 64; k++)
+    {
+      secs[k] = sweepTime(rotation, 16 * k);
+    }
+    runBench("Rotation_Const_Axis_Traj/getQuaternionBatch(64)", [&](int64_t i) {
+      if ((i & 63) == 0)
+      {
+        rotation.getQuaternionBatch(secs, quats, 64);
+        doNotOptimize(quats[0]);
+      }
+    });
+  }
+  benchQuaternion<Quaternion_Interp_Traj>("Quaternion_Interp_Traj", makeQuaternionInterp);
+  benchQuaternion<Quaternion_Squad_Traj>("Quaternion_Squad_Traj(5)", makeQuaternionSquad);
+  benchSquadDerivatives();
+
+  benchCartesian<Cartesian_Independent_Traj>("Cartesian_Independent_Traj", makeCartesianIndependent);
+  benchCartesian<COR_Traj>("COR_Traj", makeCOR);
+  const COR_Traj cor_traj = makeCOR();
+  benchCartesian<Sampled_Cartesian_Traj>("Sampled_Cartesian_Traj(COR_Traj 1ms)",
+                                         [&]() { return Sampled_Cartesian_Traj(cor_traj, 0.001); });
+
+  benchVector<Vector_Independent_Traj>("Vector_Independent_Traj(7)", makeVectorIndependent);
+  benchVector<Vector_Quintic_Poly_Traj>("Vector_Quintic_Poly_Traj(7)", makeVectorQuintic);
+
+  benchBatchEvaluator();
+
+  benchOTG();
+
+  reportRecurrenceError();
+
+  reportBSplineError();
+
+  reportSynchronizedCheck();
+
+  return 0;
+}
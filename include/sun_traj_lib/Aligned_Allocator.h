@@ -0,0 +1,87 @@
+/*
+
+    Aligned Allocator
+    Std allocator for aligned contiguous buffers
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef ALIGNED_ALLOCATOR_H
+#define ALIGNED_ALLOCATOR_H
+
+#include <stdlib.h>
+#include <cstddef>
+#include <new>
+
+namespace sun
+{
+//! Minimal std allocator returning memory aligned to Alignment bytes (e.g. for AVX loads)
+template <class T, std::size_t Alignment = 32>
+class Aligned_Allocator
+{
+public:
+  typedef T value_type;
+
+  template <class U>
+  struct rebind
+  {
+    typedef Aligned_Allocator<U, Alignment> other;
+  };
+
+  Aligned_Allocator()
+  {
+  }
+
+  template <class U>
+  Aligned_Allocator(const Aligned_Allocator<U, Alignment>&)
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    void* p = nullptr;
+    if (posix_memalign(&p, Alignment, n * sizeof(T)) != 0)
+    {
+      throw std::bad_alloc();
+    }
+    return static_cast<T*>(p);
+  }
+
+  void deallocate(T* p, std::size_t)
+  {
+    free(p);
+  }
+
+};  // END CLASS Aligned_Allocator
+
+template <class T, class U, std::size_t Alignment>
+bool operator==(const Aligned_Allocator<T, Alignment>&, const Aligned_Allocator<U, Alignment>&)
+{
+  return true;
+}
+
+template <class T, class U, std::size_t Alignment>
+bool operator!=(const Aligned_Allocator<T, Alignment>&, const Aligned_Allocator<U, Alignment>&)
+{
+  return false;
+}
+
+}  // namespace sun
+
+#endif
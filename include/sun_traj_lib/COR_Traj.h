@@ -54,18 +54,40 @@ public:
   COR_Traj(const TooN::Vector<3>& COR, const TooN::Vector<3>& normal, const TooN::Vector<3>& pi,
            const UnitQuaternion& initial_quat, const Scalar_Traj_Interface& traj_theta);
 
-  COR_Traj(const UnitQuaternion& initial_quat, const Position_Circumference_Traj& circ_traj);
+  /*!
+      Constructor from the circumference of the position (circ_traj is moved in, pass an rvalue to avoid the copy)
+  */
+  COR_Traj(const UnitQuaternion& initial_quat, Position_Circumference_Traj circ_traj);
 
   /*!
       Copy Constructor
   */
   COR_Traj(const COR_Traj& traj) = default;
 
+  /*!
+      Copy Constructor, a non built-in angle traj is cloned in arena
+  */
+  COR_Traj(const COR_Traj& traj, Traj_Arena& arena);
+
+  /*!
+      Move Constructor
+  */
+  COR_Traj(COR_Traj&& traj) = default;
+
+  COR_Traj& operator=(const COR_Traj& traj) = default;
+
+  COR_Traj& operator=(COR_Traj&& traj) = default;
+
   /*!
       Clone the object in the heap
   */
   virtual COR_Traj* clone() const override;
 
+  /*!
+      Clone the object in the arena
+  */
+  virtual COR_Traj* cloneInto(Traj_Arena& arena) const override;
+
   /*======END CONSTRUCTORS=========*/
 
   /*====== GETTERS =========*/
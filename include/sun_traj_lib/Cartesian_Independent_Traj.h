@@ -29,6 +29,7 @@
 #include "sun_traj_lib/Cartesian_Traj_Interface.h"
 #include "sun_traj_lib/Position_Traj_Interface.h"
 #include "sun_traj_lib/Quaternion_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Arena.h"
 
 namespace sun
 {
@@ -46,9 +47,12 @@ private:
   TooN::Vector<6, int> _mask;
 
 protected:
-  Position_Traj_Interface_Ptr _pos_traj;
+  /*!
+      Children, in the heap or in the arena of the traj (see cloneInto())
+  */
+  std::unique_ptr<Position_Traj_Interface, Traj_Deleter> _pos_traj;
 
-  Quaternion_Traj_Interface_Ptr _quat_traj;
+  std::unique_ptr<Quaternion_Traj_Interface, Traj_Deleter> _quat_traj;
 
 public:
   /*======CONSTRUCTORS=========*/
@@ -58,16 +62,40 @@ public:
   */
   Cartesian_Independent_Traj(const Position_Traj_Interface& pos_traj, const Quaternion_Traj_Interface& quat_traj);
 
+  /*!
+      Constructor, take ownership of pos_traj and quat_traj (not null)
+  */
+  Cartesian_Independent_Traj(Position_Traj_Interface_Ptr&& pos_traj, Quaternion_Traj_Interface_Ptr&& quat_traj);
+
   /*!
       Copy Constructor
   */
   Cartesian_Independent_Traj(const Cartesian_Independent_Traj& traj);
 
+  /*!
+      Copy Constructor, the children are cloned in arena
+  */
+  Cartesian_Independent_Traj(const Cartesian_Independent_Traj& traj, Traj_Arena& arena);
+
+  /*!
+      Move Constructor, traj is left without children (it can only be destroyed or assigned)
+  */
+  Cartesian_Independent_Traj(Cartesian_Independent_Traj&& traj) = default;
+
+  Cartesian_Independent_Traj& operator=(const Cartesian_Independent_Traj& traj);
+
+  Cartesian_Independent_Traj& operator=(Cartesian_Independent_Traj&& traj) = default;
+
   /*!
       Clone the object in the heap
   */
   virtual Cartesian_Independent_Traj* clone() const override;
 
+  /*!
+      Clone the object and its children in the arena
+  */
+  virtual Cartesian_Independent_Traj* cloneInto(Traj_Arena& arena) const override;
+
   /*======END CONSTRUCTORS=========*/
 
   /*====== GETTERS =========*/
@@ -101,6 +129,26 @@ public:
   */
   virtual void changeInitialTime(double initial_time) override;
 
+  /*!
+      Set the position trajectory
+  */
+  virtual void setPositionTraj(const Position_Traj_Interface& pos_traj);
+
+  /*!
+      Set the position trajectory taking ownership of pos_traj (not null)
+  */
+  virtual void setPositionTraj(Position_Traj_Interface_Ptr&& pos_traj);
+
+  /*!
+      Set the quaternion trajectory
+  */
+  virtual void setQuaternionTraj(const Quaternion_Traj_Interface& quat_traj);
+
+  /*!
+      Set the quaternion trajectory taking ownership of quat_traj (not null)
+  */
+  virtual void setQuaternionTraj(Quaternion_Traj_Interface_Ptr&& quat_traj);
+
   /*====== END SETTERS =========*/
 
   /*====== TRANSFORM =========*/
@@ -0,0 +1,169 @@
+/*
+
+    Cartesian Traj Batch Evaluator
+    Parallel evaluation of many cartesian trajectories on a time grid
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef CARTESIAN_TRAJ_BATCH_EVALUATOR_H
+#define CARTESIAN_TRAJ_BATCH_EVALUATOR_H
+
+#include "sun_traj_lib/Aligned_Allocator.h"
+#include "sun_traj_lib/Cartesian_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Thread_Pool.h"
+
+namespace sun
+{
+//! Samples of many cartesian trajs on a time grid, one column (structure of arrays) per coordinate
+/*!
+    The sample of the traj i at the time j of a column is at index(i, j) = i * getNumTimes() + j
+*/
+class Cartesian_Traj_Samples
+{
+public:
+  /*!
+      Columns (same layout of Sampled_Cartesian_Traj)
+  */
+  enum Column
+  {
+    COL_POSITION = 0,           //!< x, y, z
+    COL_QUATERNION = 3,         //!< s, v_x, v_y, v_z
+    COL_LINEAR_VELOCITY = 7,    //!< x, y, z
+    COL_ANGULAR_VELOCITY = 10,  //!< x, y, z
+    NUM_COLUMNS = 13
+  };
+
+protected:
+  std::size_t _num_trajs, _num_times;
+
+  std::vector<double, Aligned_Allocator<double> > _columns[NUM_COLUMNS];
+
+public:
+  /*!
+      Constructor, preallocate num_trajs x num_times samples
+  */
+  Cartesian_Traj_Samples(std::size_t num_trajs = 0, std::size_t num_times = 0);
+
+  /*!
+      Resize to num_trajs x num_times samples, no allocation if the capacity is enough
+  */
+  void resize(std::size_t num_trajs, std::size_t num_times);
+
+  std::size_t getNumTrajs() const
+  {
+    return _num_trajs;
+  }
+
+  std::size_t getNumTimes() const
+  {
+    return _num_times;
+  }
+
+  std::size_t index(std::size_t traj, std::size_t time) const
+  {
+    return traj * _num_times + time;
+  }
+
+  /*!
+      Column c (c in [0, NUM_COLUMNS), e.g. COL_QUATERNION + 1 is v_x of the quaternion)
+  */
+  double* column(int c)
+  {
+    return _columns[c].data();
+  }
+
+  const double* column(int c) const
+  {
+    return _columns[c].data();
+  }
+
+};  // END CLASS Cartesian_Traj_Samples
+
+//! Evaluate many cartesian trajs on a time grid in parallel
+/*!
+    Each traj is a task of a Traj_Thread_Pool (work stealing), so trajs with different evaluation cost are balanced.
+    The results are written in a preallocated Cartesian_Traj_Samples.
+    The trajs are only read (const methods): they have to be safe for concurrent const calls, as the trajs of this lib.
+*/
+class Cartesian_Traj_Batch_Evaluator
+{
+private:
+  Cartesian_Traj_Batch_Evaluator(const Cartesian_Traj_Batch_Evaluator&) = delete;
+  Cartesian_Traj_Batch_Evaluator& operator=(const Cartesian_Traj_Batch_Evaluator&) = delete;
+
+protected:
+  Traj_Thread_Pool _pool;
+
+public:
+  /*!
+      Constructor, num_threads = 0 -> std::thread::hardware_concurrency()
+  */
+  Cartesian_Traj_Batch_Evaluator(unsigned int num_threads = 0);
+
+  unsigned int getNumThreads() const
+  {
+    return _pool.getNumThreads();
+  }
+
+  /*!
+      Evaluate trajs[i] at times[j] for all i,j
+      relative_time = true -> times are w.r.t. the initial time of each traj
+      out is resized to trajs.size() x times.size()
+  */
+  void evaluate(const std::vector<const Cartesian_Traj_Interface*>& trajs, const std::vector<double>& times,
+                Cartesian_Traj_Samples& out, bool relative_time = false);
+
+  void evaluate(const std::vector<Cartesian_Traj_Interface_Ptr>& trajs, const std::vector<double>& times,
+                Cartesian_Traj_Samples& out, bool relative_time = false);
+
+  /*!
+      Evaluate num_trajs trajs, traj(i) returns the i-th traj
+  */
+  template <class Get_Traj>
+  void evaluate(std::size_t num_trajs, Get_Traj&& traj, const std::vector<double>& times,
+                Cartesian_Traj_Samples& out, bool relative_time = false);
+
+  /*!
+      Evaluate traj at times[j] for all j, write the samples of row traj_index of out
+  */
+  static void evaluateTraj(const Cartesian_Traj_Interface& traj, const std::vector<double>& times,
+                           Cartesian_Traj_Samples& out, std::size_t traj_index, bool relative_time = false);
+
+};  // END CLASS Cartesian_Traj_Batch_Evaluator
+
+using Cartesian_Traj_Batch_Evaluator_Ptr = std::unique_ptr<Cartesian_Traj_Batch_Evaluator>;
+
+/*====== TEMPLATE IMPLEMENTATION =========*/
+
+template <class Get_Traj>
+void Cartesian_Traj_Batch_Evaluator::evaluate(std::size_t num_trajs, Get_Traj&& traj,
+                                              const std::vector<double>& times, Cartesian_Traj_Samples& out,
+                                              bool relative_time)
+{
+  out.resize(num_trajs, times.size());
+  auto task = [&](std::size_t i) { evaluateTraj(traj(i), times, out, i, relative_time); };
+  _pool.parallelFor(num_trajs, task);
+}
+
+/*====== END TEMPLATE IMPLEMENTATION =========*/
+
+}  // namespace sun
+
+#endif
@@ -98,13 +98,11 @@ public:
       Change the reference frame of the trajectory
       Apply an homogeneous transfrmation matrix to the trajectory
       new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+      Not implemented by default: fatal error (if the fatal handler returns the traj is unchanged)
   */
   virtual void changeFrame(const TooN::Matrix<4, 4>& new_T_curr)
   {
-    std::cout << TRAJ_ERROR_COLOR "Error in Cartesian_Traj_Interface::changeFrame( TooN::Matrix<4,4> new_T_curr ) | "
-                                  "Not implemented..." CRESET
-              << std::endl;
-    exit(-1);
+    trajFatal("Error in Cartesian_Traj_Interface::changeFrame( TooN::Matrix<4,4> new_T_curr ) | Not implemented...");
   }
 
   /*!
@@ -0,0 +1,198 @@
+/*
+
+    Cartesian Traj Sequence
+    Cartesian traj made of a sequence of cartesian trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef CARTESIAN_TRAJ_SEQUENCE_H
+#define CARTESIAN_TRAJ_SEQUENCE_H
+
+#include "sun_traj_lib/Cartesian_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Sequence_Index.h"
+
+namespace sun
+{
+//! Cartesian traj made of a sequence of cartesian trajs
+/*!
+    The segments are sorted by initial time, at time secs the last started segment is evaluated
+    (the first one before the start of the sequence, the last one after its end).
+    The active segment is found in O(log n), amortized O(1) for monotonic queries (see Traj_Sequence_Index).
+    The sequence must not be empty when it is evaluated.
+*/
+class Cartesian_Traj_Sequence : public Cartesian_Traj_Interface
+{
+private:
+  /*
+      Block access to these vars
+  */
+  double _initial_time, _final_time;
+
+protected:
+  /*!
+      Segments of the sequence
+  */
+  std::vector<Cartesian_Traj_Interface_Ptr> _traj_vec;
+
+  /*!
+      Time index of the segments
+  */
+  Traj_Sequence_Index _index;
+
+  /* ====== CONSTRUCTORS =======*/
+
+public:
+  /*!
+      Void Constructor (empty sequence)
+  */
+  Cartesian_Traj_Sequence();
+
+  /*!
+      Full constructor, the trajs have to be sorted by initial time
+  */
+  Cartesian_Traj_Sequence(const std::vector<Cartesian_Traj_Interface_Ptr>& traj_vec);
+
+  /*!
+      Copy Constructor
+  */
+  Cartesian_Traj_Sequence(const Cartesian_Traj_Sequence& traj);
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Cartesian_Traj_Sequence* clone() const override;
+
+  /* ====== END CONSTRUCTORS =======*/
+
+  /* ====== SETTERS =========*/
+
+  /*!
+      Push back a trajectory in the sequence
+      Its initial time has to be >= the initial time of the last segment,
+      otherwise the traj is discarded (error message) and false is returned
+  */
+  virtual bool push_back_traj(const Cartesian_Traj_Interface& traj);
+
+  /*!
+      Remove last traj of the sequence
+  */
+  virtual void pop_back_traj();
+
+  /*!
+      Remove all the trajs of the sequence
+  */
+  virtual void clear();
+
+  /*!
+      Change the initial time instant (translate all the trajectories in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /*!
+      Set the mask of all the segments
+  */
+  virtual void setMask(TooN::Vector<6, int> mask) override;
+
+  /* ====== END SETTERS =========*/
+
+  /*====== TRANSFORM =========*/
+
+  using Cartesian_Traj_Interface::changeFrame;
+
+  /*!
+      Change the reference frame of all the segments
+      new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+  */
+  virtual void changeFrame(const TooN::Matrix<4, 4>& new_T_curr) override;
+
+  /*====== END TRANSFORM =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Get the mask of the active segment at time secs
+  */
+  virtual TooN::Vector<6, int> getMask(double secs) const override;
+
+  /*!
+      Number of segments
+  */
+  virtual int size() const;
+
+  /*!
+      Get the i-th segment
+  */
+  virtual const Cartesian_Traj_Interface& getTraj(int i) const;
+
+  /*!
+      Index of the active segment at time secs
+  */
+  virtual int getSegmentIndex(double secs) const;
+
+  /*!
+      Get the final time instant
+      It is the max final time
+  */
+  virtual double getFinalTime() const override;
+
+  /*!
+      Get the initial time instant
+      It is the initial time of the first segment
+  */
+  virtual double getInitialTime() const override;
+
+  /*====== END GETTERS =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual TooN::Vector<3> getPosition(double secs) const override;
+
+  /*!
+      Get Quaternion at time secs
+  */
+  virtual UnitQuaternion getQuaternion(double secs) const override;
+
+  /*!
+      Get Linear Velocity at time secs
+  */
+  virtual TooN::Vector<3> getLinearVelocity(double secs) const override;
+
+  /*!
+      Get Angular Velocity at time secs
+  */
+  virtual TooN::Vector<3> getAngularVelocity(double secs) const override;
+
+  /*!
+      Get Twist Velocity at time secs [ v , w ]^T (a single segment lookup)
+  */
+  virtual TooN::Vector<6> getTwist(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Cartesian_Traj_Sequence
+
+using Cartesian_Traj_Sequence_Ptr = std::unique_ptr<Cartesian_Traj_Sequence>;
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,217 @@
+/*
+
+    Double S Traj
+    Scalar trajectory with jerk limited (double S) velocity profile
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef DOUBLE_S_TRAJ_H
+#define DOUBLE_S_TRAJ_H
+
+#include <math.h>
+#include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Result.h"
+
+namespace sun
+{
+//! Scalar Traj with jerk limited (double S) velocity profile
+/*!
+    Minimum time rest-to-rest motion from initial_position to final_position with
+    |velocity| <= max_velocity, |acceleration| <= max_acceleration, |jerk| <= max_jerk.
+    The profile has 7 segments with jerk +j, 0, -j, 0, -j, 0, +j (some segments may have zero duration
+    if a limit is not reached).
+    The segment times and the cubic coefficients of each segment are computed in the constructor,
+    a sample is a search in the 8 segment boundaries and a cubic.
+    \sa Trapez_Vel_Traj
+*/
+class Double_S_Traj : public Scalar_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Double_S_Traj();
+
+protected:
+  /*!
+      initial position, final position
+  */
+  double _pi, _pf;
+
+  /*!
+      jerk time, acceleration time, cruise duration
+  */
+  double _tj, _ta, _tv;
+
+  /*!
+      jerk of the first segment (sign of the displacement * max_jerk)
+  */
+  double _j;
+
+  /*!
+      Start times of the 7 segments relative to the initial time, _seg_time[7] is the duration
+  */
+  double _seg_time[8];
+
+  /*!
+      Coefficients of the segments: p = c0 + c1*dt + c2*dt^2 + c3*dt^3 (dt from the segment start)
+  */
+  double _seg_coeff[7][4];
+
+  /*!
+      Compute the times from the limits and the displacement (limits are positive)
+  */
+  static void computeTimes(double displacement, double max_velocity, double max_acceleration, double max_jerk,
+                           double& tj, double& ta, double& tv);
+
+  /*!
+      Fill the segment table from _pi, _j, _tj, _ta, _tv
+  */
+  void updateSegments();
+
+  /*!
+      Segment at time t (relative to the initial time), t must be in [0, duration]
+  */
+  inline int segment(double t) const
+  {
+    int k = 0;
+    while (k < 6 && t >= _seg_time[k + 1])
+    {
+      k++;
+    }
+    return k;
+  }
+
+public:
+  /*!
+      return true if the limits are valid (positive and finite) and the positions are finite
+  */
+  static bool checkDoubleS(double initial_position, double final_position, double max_velocity,
+                           double max_acceleration, double max_jerk);
+
+  /*=======CONSTRUCTORS======*/
+
+  /*!
+      Constructor
+      Non valid limits are a fatal error (see Traj_Fatal_Handler),
+      if the handler returns the traj holds the initial position
+  */
+  Double_S_Traj(double initial_position, double final_position, double max_velocity, double max_acceleration,
+                double max_jerk, double initial_time = 0.0);
+
+  /*!
+      Non-fatal factory, validate the inputs and return the traj or an error status
+      No diagnostic is emitted, no heap allocation is performed
+  */
+  static Traj_Result<Double_S_Traj> create(double initial_position, double final_position, double max_velocity,
+                                           double max_acceleration, double max_jerk, double initial_time = 0.0);
+
+  /*!
+      Copy Constructor
+  */
+  Double_S_Traj(const Double_S_Traj& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Double_S_Traj* clone() const override;
+
+  /*!
+      Clone the object in the arena
+  */
+  virtual Double_S_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*=======END CONSTRUCTORS======*/
+
+  /*======= GETTERS =========*/
+
+  virtual double getInitialPosition() const;
+
+  virtual double getFinalPosition() const;
+
+  /*!
+      Get the duration of the constant jerk phases
+  */
+  double getJerkTime() const;
+
+  /*!
+      Get the duration of the acceleration (and deceleration) phase
+  */
+  double getAccelerationTime() const;
+
+  /*!
+      Get the duration of the constant velocity phase
+  */
+  double getCruiseDuration() const;
+
+  /*!
+      Get the velocity of the constant velocity phase (can be lower than max_velocity for short motions)
+  */
+  double getCruiseSpeed() const;
+
+  /*======= END GETTERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual double getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual double getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual double getAcceleration(double secs) const override;
+
+  /*!
+      Get Jerk at time secs
+  */
+  virtual double getJerk(double secs) const;
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  virtual Scalar_Traj_State getState(double secs) const override;
+
+  /*!
+      Get Position at the n time instants secs[0..n-1]
+  */
+  virtual void getPositionBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Velocity at the n time instants secs[0..n-1]
+  */
+  virtual void getVelocityBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Acceleration at the n time instants secs[0..n-1]
+  */
+  virtual void getAccelerationBatch(const double* secs, double* out, int n) const override;
+
+};  // END CLASS Double_S_Traj
+
+using Double_S_Traj_Ptr = std::unique_ptr<Double_S_Traj>;
+
+}  // namespace sun
+
+#endif
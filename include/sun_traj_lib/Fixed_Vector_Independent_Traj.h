@@ -0,0 +1,266 @@
+/*
+
+    Fixed Vector Independent Traj Class
+    This class generates a fixed size vector trajectory basing on independent scalar trajectories
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef FIXED_VECTOR_INDEPENDENT_TRAJ_H
+#define FIXED_VECTOR_INDEPENDENT_TRAJ_H
+
+#include <array>
+#include <cmath>
+#include "TooN/TooN.h"
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
+
+namespace sun
+{
+//! Vectorial Trajectory of fixed dimension N made of Independent Scalar trajs
+/*!
+    Compile-time sized version of Vector_Independent_Traj, outputs are TooN::Vector<N> (no heap allocation)
+    Use Fixed_Vector_Traj_Adapter to use it as a Vector_Traj_Interface
+    \sa Vector_Independent_Traj, Fixed_Vector_Traj_Adapter
+*/
+template <int N>
+class Fixed_Vector_Independent_Traj : public Traj_Generator_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Fixed_Vector_Independent_Traj();
+
+  /*
+      Block access to these vars
+  */
+  double _initial_time, _final_time;
+
+protected:
+  /*!
+      std::array containing the trajectories
+      Built-in profiles are stored inline (see Scalar_Traj_Variant)
+  */
+  std::array<Scalar_Traj_Variant, N> _traj_vec;
+
+public:
+  /* ====== CONSTRUCTORS =======*/
+
+  /*!
+      Full constructor
+  */
+  Fixed_Vector_Independent_Traj(const std::array<Scalar_Traj_Interface_Ptr, N>& traj_vec)
+    : Traj_Generator_Interface(NAN, NAN)
+  {
+    for (int i = 0; i < N; i++)
+    {
+      _traj_vec[i] = *traj_vec[i];
+    }
+  }
+
+  /*!
+      Constructor that creates N equal trajectories
+  */
+  Fixed_Vector_Independent_Traj(const Scalar_Traj_Interface& traj) : Traj_Generator_Interface(NAN, NAN)
+  {
+    _traj_vec.fill(Scalar_Traj_Variant(traj));
+  }
+
+  /*!
+      Copy Constructor
+  */
+  Fixed_Vector_Independent_Traj(const Fixed_Vector_Independent_Traj& traj)
+    : Traj_Generator_Interface(NAN, NAN), _traj_vec(traj._traj_vec)
+  {
+  }
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Fixed_Vector_Independent_Traj* clone() const override
+  {
+    return new Fixed_Vector_Independent_Traj(*this);
+  }
+
+  /* ====== END CONSTRUCTORS =======*/
+
+  /* ====== SETTERS =========*/
+
+  /*!
+      Set the i-th trajectory
+  */
+  virtual void setTraj(int i, const Scalar_Traj_Interface& traj)
+  {
+    _traj_vec[i] = traj;
+  }
+
+  /*!
+      Change the initial time instant (translate all the trajectories in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override
+  {
+    double Delta_T = getInitialTime() - initial_time;
+    for (auto& element : _traj_vec)
+    {
+      element.changeInitialTime(element.getInitialTime() - Delta_T);
+    }
+  }
+
+  /* ====== END SETTERS =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      get size of the vector
+  */
+  static constexpr int size()
+  {
+    return N;
+  }
+
+  /*!
+      Get the i-th trajectory
+  */
+  const Scalar_Traj_Interface& getTraj(int i) const
+  {
+    return _traj_vec[i].get();
+  }
+
+  /*!
+      Get the final time instant
+      It is the max final time
+  */
+  virtual double getFinalTime() const override
+  {
+    double final_time = -INFINITY;
+    for (const auto& element : _traj_vec)
+    {
+      double ith_final_time = element.getFinalTime();
+      if (ith_final_time > final_time)
+        final_time = ith_final_time;
+    }
+    return final_time;
+  }
+
+  /*!
+      Get the initial time instant
+      It is the min initial time
+  */
+  virtual double getInitialTime() const override
+  {
+    double initial_time = INFINITY;
+    for (const auto& element : _traj_vec)
+    {
+      double ith_initial_time = element.getInitialTime();
+      if (ith_initial_time < initial_time)
+        initial_time = ith_initial_time;
+    }
+    return initial_time;
+  }
+
+  /*====== END GETTERS =========*/
+
+  /*!
+      return true if all the trajectories are compleate at time secs
+  */
+  virtual bool isCompleate(double secs) const override
+  {
+    for (const auto& element : _traj_vec)
+    {
+      if (!element.isCompleate(secs))
+        return false;
+    }
+    return true;
+  }
+
+  /*!
+      return true if the at least one trajectory is started at time secs
+  */
+  virtual bool isStarted(double secs) const override
+  {
+    for (const auto& element : _traj_vec)
+    {
+      if (element.isStarted(secs))
+        return true;
+    }
+    return false;
+  }
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  TooN::Vector<N> getPosition(double secs) const
+  {
+    TooN::Vector<N> out;
+    for (int i = 0; i < N; i++)
+    {
+      out[i] = _traj_vec[i].getPosition(secs);
+    }
+    return out;
+  }
+
+  /*!
+      Get Velocity at time secs
+  */
+  TooN::Vector<N> getVelocity(double secs) const
+  {
+    TooN::Vector<N> out;
+    for (int i = 0; i < N; i++)
+    {
+      out[i] = _traj_vec[i].getVelocity(secs);
+    }
+    return out;
+  }
+
+  /*!
+      Get Acceleration at time secs
+  */
+  TooN::Vector<N> getAcceleration(double secs) const
+  {
+    TooN::Vector<N> out;
+    for (int i = 0; i < N; i++)
+    {
+      out[i] = _traj_vec[i].getAcceleration(secs);
+    }
+    return out;
+  }
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  void getState(double secs, TooN::Vector<N>& pos, TooN::Vector<N>& vel, TooN::Vector<N>& acc) const
+  {
+    for (int i = 0; i < N; i++)
+    {
+      Scalar_Traj_State state = _traj_vec[i].getState(secs);
+      pos[i] = state.position;
+      vel[i] = state.velocity;
+      acc[i] = state.acceleration;
+    }
+  }
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Fixed_Vector_Independent_Traj
+
+}  // namespace sun
+
+#endif
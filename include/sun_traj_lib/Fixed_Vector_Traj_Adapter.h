@@ -0,0 +1,223 @@
+/*
+
+    Fixed Vector Traj Adapter Class
+    This class adapts a Fixed_Vector_Independent_Traj to the Vector_Traj_Interface
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef FIXED_VECTOR_TRAJ_ADAPTER_H
+#define FIXED_VECTOR_TRAJ_ADAPTER_H
+
+#include "sun_traj_lib/Fixed_Vector_Independent_Traj.h"
+#include "sun_traj_lib/Vector_Traj_Interface.h"
+
+namespace sun
+{
+//! Adapter that exposes a Fixed_Vector_Independent_Traj<N> as a Vector_Traj_Interface
+template <int N>
+class Fixed_Vector_Traj_Adapter : public Vector_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Fixed_Vector_Traj_Adapter();
+
+  /*
+      Block access to these vars
+  */
+  double _initial_time, _final_time;
+
+protected:
+  /*!
+      The adapted trajectory
+  */
+  Fixed_Vector_Independent_Traj<N> _traj;
+
+public:
+  /*====== CONSTRUCTORS =========*/
+
+  /*!
+      Constructor
+  */
+  Fixed_Vector_Traj_Adapter(const Fixed_Vector_Independent_Traj<N>& traj) : Vector_Traj_Interface(NAN, NAN), _traj(traj)
+  {
+  }
+
+  /*!
+      Copy Constructor
+  */
+  Fixed_Vector_Traj_Adapter(const Fixed_Vector_Traj_Adapter& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Fixed_Vector_Traj_Adapter* clone() const override
+  {
+    return new Fixed_Vector_Traj_Adapter(*this);
+  }
+
+  /*====== END CONSTRUCTORS =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Get the adapted trajectory
+  */
+  const Fixed_Vector_Independent_Traj<N>& getFixedTraj() const
+  {
+    return _traj;
+  }
+
+  /*!
+      Get the final time instant
+  */
+  virtual double getFinalTime() const override
+  {
+    return _traj.getFinalTime();
+  }
+
+  /*!
+      Get the initial time instant
+  */
+  virtual double getInitialTime() const override
+  {
+    return _traj.getInitialTime();
+  }
+
+  /*====== END GETTERS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Change the initial time instant (translate the trajectory in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override
+  {
+    _traj.changeInitialTime(initial_time);
+  }
+
+  /*====== END SETTERS =========*/
+
+  /*!
+      return true if all the trajectories are compleate at time secs
+  */
+  virtual bool isCompleate(double secs) const override
+  {
+    return _traj.isCompleate(secs);
+  }
+
+  /*!
+      return true if the at least one trajectory is started at time secs
+  */
+  virtual bool isStarted(double secs) const override
+  {
+    return _traj.isStarted(secs);
+  }
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual TooN::Vector<> getPosition(double secs) const override
+  {
+    return _traj.getPosition(secs);
+  }
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual TooN::Vector<> getVelocity(double secs) const override
+  {
+    return _traj.getVelocity(secs);
+  }
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual TooN::Vector<> getAcceleration(double secs) const override
+  {
+    return _traj.getAcceleration(secs);
+  }
+
+  /*====== END RUNNERS =========*/
+
+protected:
+  /*====== ALLOCATION FREE HOOKS =========*/
+
+  /*!
+      Write Position at time secs in out
+  */
+  virtual void writePosition(double secs, double* out) const override
+  {
+    TooN::Vector<N> v = _traj.getPosition(secs);
+    for (int i = 0; i < N; i++)
+      out[i] = v[i];
+  }
+
+  /*!
+      Write Velocity at time secs in out
+  */
+  virtual void writeVelocity(double secs, double* out) const override
+  {
+    TooN::Vector<N> v = _traj.getVelocity(secs);
+    for (int i = 0; i < N; i++)
+      out[i] = v[i];
+  }
+
+  /*!
+      Write Acceleration at time secs in out
+  */
+  virtual void writeAcceleration(double secs, double* out) const override
+  {
+    TooN::Vector<N> v = _traj.getAcceleration(secs);
+    for (int i = 0; i < N; i++)
+      out[i] = v[i];
+  }
+
+  /*!
+      Write Position, Velocity and Acceleration at time secs
+      in pos, vel and acc, a null pointer is skipped
+  */
+  virtual void writeState(double secs, double* pos, double* vel, double* acc) const override
+  {
+    if (!pos || !vel || !acc)
+    {
+      Vector_Traj_Interface::writeState(secs, pos, vel, acc);
+      return;
+    }
+    TooN::Vector<N> p, v, a;
+    _traj.getState(secs, p, v, a);
+    for (int i = 0; i < N; i++)
+    {
+      pos[i] = p[i];
+      vel[i] = v[i];
+      acc[i] = a[i];
+    }
+  }
+
+  /*====== END ALLOCATION FREE HOOKS =========*/
+
+};  // END CLASS Fixed_Vector_Traj_Adapter
+
+}  // namespace sun
+
+#endif
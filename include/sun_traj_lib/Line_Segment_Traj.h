@@ -26,7 +26,7 @@
 #define LINE_SEGMENT_TRAJ_H
 
 #include "sun_traj_lib/Position_Traj_Interface.h"
-#include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
 
 namespace sun
 {
@@ -56,8 +56,9 @@ protected:
   /*!
       Trajectory for the scalar s variable should be a traj from 0 to 1
       s = 0 -> _pi   &   s = 1 -> _pf
+      Built-in profiles are stored inline (see Scalar_Traj_Variant)
   */
-  Scalar_Traj_Interface_Ptr _traj_s;
+  Scalar_Traj_Variant _traj_s;
 
 public:
   /*======CONSTRUCTORS========*/
@@ -72,11 +73,35 @@ public:
   */
   Line_Segment_Traj(const Line_Segment_Traj& traj);
 
+  /*!
+      Copy Constructor, a non built-in scalar traj is cloned in arena
+  */
+  Line_Segment_Traj(const Line_Segment_Traj& traj, Traj_Arena& arena);
+
+  /*!
+      Move Constructor
+  */
+  Line_Segment_Traj(Line_Segment_Traj&& traj) = default;
+
+  Line_Segment_Traj& operator=(const Line_Segment_Traj& traj) = default;
+
+  Line_Segment_Traj& operator=(Line_Segment_Traj&& traj) = default;
+
   /*!
       Clone the object in the heap
   */
   virtual Line_Segment_Traj* clone() const override;
 
+  /*!
+      Clone the object in the arena
+  */
+  virtual Line_Segment_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*!
+      Create in the heap a cursor placed at time secs, for streaming evaluation (see Position_Traj_Cursor)
+  */
+  virtual Position_Traj_Cursor* createCursor(double secs) const override;
+
   /*======END CONSTRUCTORS========*/
 
   /*====== GETTERS ========*/
@@ -135,6 +160,11 @@ public:
   */
   virtual void setScalarTraj(const Scalar_Traj_Interface& s_traj);
 
+  /*!
+      Set the scalar trajectory taking ownership of s_traj (no copy of a non built-in profile)
+  */
+  virtual void setScalarTraj(Scalar_Traj_Interface_Ptr&& s_traj);
+
   /*!
       TODO
   */
@@ -0,0 +1,88 @@
+/*
+
+    Line Segment Traj Cursor
+    Cursor of a line segment trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef LINE_SEGMENT_TRAJ_CURSOR_H
+#define LINE_SEGMENT_TRAJ_CURSOR_H
+
+#include "sun_traj_lib/Position_Traj_Cursor.h"
+#include "sun_traj_lib/Scalar_Traj_Cursor.h"
+
+namespace sun
+{
+//! Cursor of a Line_Segment_Traj
+/*!
+    The scalar s profile is advanced by its own cursor (e.g. phase tracking of a trapezoidal profile),
+    a single scalar state is evaluated per tick.
+*/
+class Line_Segment_Traj_Cursor : public Position_Traj_Cursor
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Line_Segment_Traj_Cursor();
+
+protected:
+  /*!
+      Initial Position
+  */
+  TooN::Vector<3> _pi;
+
+  /*!
+      Final Position - Initial Position
+  */
+  TooN::Vector<3> _delta;
+
+  /*!
+      Cursor of the s profile
+  */
+  Scalar_Traj_Cursor_Ptr _s_cursor;
+
+  /*!
+      Compute the state from the state of _s_cursor
+  */
+  void updateState();
+
+public:
+  /*!
+      Constructor, the cursor is placed at time secs
+  */
+  Line_Segment_Traj_Cursor(const TooN::Vector<3>& pi, const TooN::Vector<3>& pf, const Scalar_Traj_Interface& traj_s,
+                           double secs);
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) override;
+
+  /*!
+      Move the cursor forward by dt
+  */
+  virtual void advance(double dt) override;
+
+};  // END CLASS Line_Segment_Traj_Cursor
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,175 @@
+/*
+
+    OTG Traj
+    Scalar trajectory for online trajectory generation from an arbitrary initial state
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef OTG_TRAJ_H
+#define OTG_TRAJ_H
+
+#include <math.h>
+#include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Result.h"
+
+namespace sun
+{
+//! Scalar Traj for Online Trajectory Generation (OTG)
+/*!
+    Time-optimal motion from an arbitrary initial state (position, velocity) to a final position at rest
+    with |velocity| <= max_velocity (after the initial phase) and |acceleration| <= max_acceleration.
+    The profile has 3 phases (acceleration +-max_acceleration, cruise, acceleration +-max_acceleration)
+    computed in closed form: no iterations, no allocation, bounded time (the constructor can be called at each
+    control cycle to replan from the current state).
+    If the initial speed is over max_velocity the first phase brings it back to max_velocity,
+    if the final position cannot be reached without overshoot the profile reverses.
+    The initial acceleration is not a state of this (second order) profile: the acceleration can jump
+    at the initial time.
+    \sa Trapez_Vel_Traj, Vector_OTG_Traj
+*/
+class OTG_Traj : public Scalar_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  OTG_Traj();
+
+protected:
+  /*!
+      initial position, initial velocity, final position
+  */
+  double _pi, _vi, _pf;
+
+  /*!
+      Start times of the 3 phases relative to the initial time, _seg_time[3] is the duration
+  */
+  double _seg_time[4];
+
+  /*!
+      Coefficients of the phases: p = c0 + c1*dt + c2*dt^2 (dt from the phase start)
+  */
+  double _seg_coeff[3][3];
+
+  /*!
+      Compute the phases (acceleration, duration) from the displacement, the initial velocity and the limits
+      (limits are positive)
+  */
+  static void computePhases(double displacement, double initial_velocity, double max_velocity,
+                            double max_acceleration, double acc[3], double duration[3]);
+
+  /*!
+      Fill the phase table from _pi, _vi and the phases
+  */
+  void updateSegments(const double acc[3], const double duration[3]);
+
+  /*!
+      Phase at time t (relative to the initial time), t must be in [0, duration]
+  */
+  inline int segment(double t) const
+  {
+    return (t < _seg_time[1]) ? 0 : ((t < _seg_time[2]) ? 1 : 2);
+  }
+
+public:
+  /*!
+      return true if the limits are valid (positive and finite) and the state is finite
+  */
+  static bool checkOTG(double initial_position, double initial_velocity, double final_position,
+                       double max_velocity, double max_acceleration);
+
+  /*=======CONSTRUCTORS======*/
+
+  /*!
+      Constructor
+      Non valid inputs are a fatal error (see Traj_Fatal_Handler),
+      if the handler returns the traj holds the initial position
+  */
+  OTG_Traj(double initial_position, double initial_velocity, double final_position, double max_velocity,
+           double max_acceleration, double initial_time = 0.0);
+
+  /*!
+      Non-fatal factory, validate the inputs and return the traj or an error status
+      No diagnostic is emitted, no heap allocation is performed
+  */
+  static Traj_Result<OTG_Traj> create(double initial_position, double initial_velocity, double final_position,
+                                      double max_velocity, double max_acceleration, double initial_time = 0.0);
+
+  /*!
+      Copy Constructor
+  */
+  OTG_Traj(const OTG_Traj& traj) = default;
+
+  OTG_Traj& operator=(const OTG_Traj& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual OTG_Traj* clone() const override;
+
+  /*!
+      Clone the object in the arena
+  */
+  virtual OTG_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*=======END CONSTRUCTORS======*/
+
+  /*======= GETTERS =========*/
+
+  virtual double getInitialPosition() const;
+
+  virtual double getInitialVelocity() const;
+
+  virtual double getFinalPosition() const;
+
+  /*!
+      Get the velocity of the cruise phase (signed)
+  */
+  double getCruiseSpeed() const;
+
+  /*======= END GETTERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual double getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual double getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual double getAcceleration(double secs) const override;
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  virtual Scalar_Traj_State getState(double secs) const override;
+
+};  // END CLASS OTG_Traj
+
+using OTG_Traj_Ptr = std::unique_ptr<OTG_Traj>;
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,284 @@
+/*
+
+    Position BSpline Traj
+    Position trajectory along a B-spline through waypoints, parameterized by arc length
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef POSITION_BSPLINE_TRAJ_H
+#define POSITION_BSPLINE_TRAJ_H
+
+#include "sun_traj_lib/Position_Traj_Interface.h"
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
+
+/*!
+    Number of intervals of the arc length table in each knot span of Position_BSpline_Traj (before the refinement)
+*/
+#define POSITION_BSPLINE_ARC_SAMPLES 16
+
+/*!
+    Relative tolerance of the quadrature of an interval of the arc length table of Position_BSpline_Traj,
+    an interval is bisected (at most POSITION_BSPLINE_ARC_MAX_DEPTH times) until its quadrature is within it
+*/
+#define POSITION_BSPLINE_ARC_TOL 1e-9
+#define POSITION_BSPLINE_ARC_MAX_DEPTH 20
+
+/*!
+    Number of Newton steps that refine the inverse of the arc length table in Position_BSpline_Traj
+*/
+#define POSITION_BSPLINE_NEWTON_STEPS 2
+
+namespace sun
+{
+//! Position traj along a B-spline (e.g. cubic or quintic) through N waypoints, parameterized by arc length
+/*!
+    The curve interpolates the waypoints (global interpolation with chord length parameters and averaged knots),
+    the control points are obtained solving the banded collocation system in O(N).
+    The scalar traj s goes from 0 to 1 and is the normalized arc length: s = 0 -> first waypoint,
+    s = 1 -> last waypoint, a constant ds/dt is a constant speed motion (|velocity| = getLength()*ds/dt).
+    The constructor caches the power basis coefficients of each knot span and an arc length table
+    (Gauss-Legendre quadrature, POSITION_BSPLINE_ARC_SAMPLES intervals per span, bisected where the quadrature
+    is not accurate): the table nodes are aligned to the knot spans, so a sample costs one binary search in the table,
+    a cubic Hermite guess of u(l) refined by POSITION_BSPLINE_NEWTON_STEPS Newton steps on the arc length
+    and the evaluation of one polynomial, independently of the number of waypoints.
+    Position, velocity and acceleration use the same u(l).
+*/
+class Position_BSpline_Traj : public Position_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Position_BSpline_Traj();
+
+  // These vars now are taken from _traj_s
+  double _duration, _initial_time;
+
+protected:
+  /*!
+      Degree of the spline
+  */
+  int _degree;
+
+  /*!
+      Waypoints (consecutive coincident waypoints are merged) and control points
+  */
+  std::vector<TooN::Vector<3> > _waypoints, _control_points;
+
+  /*!
+      Breakpoints of the spline parameter u in [0,1] (distinct knots), one knot span between two breakpoints
+  */
+  std::vector<double> _breaks;
+
+  /*!
+      Power basis coefficients of the spans: C(u) = sum_k _span_coeff[i*(degree+1)+k] (u - _breaks[i])^k
+  */
+  std::vector<TooN::Vector<3> > _span_coeff;
+
+  /*!
+      Arc length table: u at the nodes, arc length from the start and du/dl at the nodes
+  */
+  std::vector<double> _arc_u, _arc_length, _arc_du;
+
+  /*!
+      Arc length table: span of the interval that starts at the node
+  */
+  std::vector<int> _arc_span;
+
+  /*!
+      Total length of the curve
+  */
+  double _length;
+
+  /*!
+      Trajectory for the scalar s variable should be a traj from 0 to 1
+      s = 0 -> first waypoint   &   s = 1 -> last waypoint
+      Built-in profiles are stored inline (see Scalar_Traj_Variant)
+  */
+  Scalar_Traj_Variant _traj_s;
+
+  /*!
+      Compute the control points, the span coefficients and the arc length table from _waypoints
+  */
+  void updateSpline();
+
+  /*!
+      Fill the arc length table from the span coefficients
+  */
+  void updateArcLength();
+
+  /*!
+      Append the node at u of the span to the arc length table
+  */
+  void appendArcNode(int span, double u);
+
+  /*!
+      Append the nodes of the interval [u0, u1) of the span to the arc length table (bisected where needed)
+  */
+  void appendArcNodes(int span, double u0, double u1, double interval_length, int depth);
+
+  /*!
+      Arc length of the span from u0 to u
+  */
+  double spanLength(int span, double u0, double u) const;
+
+  /*!
+      Parameter u of the arc length l (l is clamped in [0, getLength()])
+      The index of the span of u is returned in span
+  */
+  double lengthToParam(double l, int& span) const;
+
+  /*!
+      Point, first and second derivative w.r.t. u of the span at u, a null pointer is skipped
+  */
+  void evalSpan(int span, double u, TooN::Vector<3>* point, TooN::Vector<3>* d1, TooN::Vector<3>* d2) const;
+
+  /*!
+      Position, velocity and acceleration at time secs, a null pointer is skipped
+  */
+  void evaluate(double secs, TooN::Vector<3>* position, TooN::Vector<3>* velocity,
+                TooN::Vector<3>* acceleration) const;
+
+public:
+  /*======CONSTRUCTORS========*/
+
+  /*!
+      Full Constructor
+      waypoints: at least 2 distinct points
+      degree: degree of the spline (3 cubic, 5 quintic), it is reduced to the number of waypoints - 1 if needed
+      Less than 2 distinct waypoints or degree < 1 is a fatal error (see Traj_Fatal_Handler),
+      if the handler returns the traj holds the first waypoint (or uses a cubic)
+  */
+  Position_BSpline_Traj(const std::vector<TooN::Vector<3> >& waypoints, const Scalar_Traj_Interface& traj_s,
+                        int degree = 3);
+
+  /*!
+      Copy Constructor
+  */
+  Position_BSpline_Traj(const Position_BSpline_Traj& traj) = default;
+
+  /*!
+      Move Constructor
+  */
+  Position_BSpline_Traj(Position_BSpline_Traj&& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Position_BSpline_Traj* clone() const override;
+
+  /*======END CONSTRUCTORS========*/
+
+  /*====== GETTERS ========*/
+
+  virtual int getDegree() const;
+
+  /*!
+      Get length of the curve
+  */
+  virtual double getLength() const;
+
+  virtual int getNumWaypoints() const;
+
+  virtual TooN::Vector<3> getWaypoint(int i) const;
+
+  virtual int getNumControlPoints() const;
+
+  virtual TooN::Vector<3> getControlPoint(int i) const;
+
+  /*!
+      Get the final time instant
+  */
+  virtual double getFinalTime() const override;
+
+  /*!
+      Get the initial time instant
+  */
+  virtual double getInitialTime() const override;
+
+  /*====== END GETTERS ========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Set the scalar trajectory
+      Trajectory for the scalar s variable should be a traj from 0 to 1 (normalized arc length)
+      Note: Velocities and accelerations
+      Since the s is normalized using getLength() also the ds and dds have to be normalized
+      e.g. _vi = dsi / bspline_traj.getLength() where bspline_traj is this object
+  */
+  virtual void setScalarTraj(const Scalar_Traj_Interface& s_traj);
+
+  /*!
+      Set the scalar trajectory taking ownership of s_traj (no copy of a non built-in profile)
+  */
+  virtual void setScalarTraj(Scalar_Traj_Interface_Ptr&& s_traj);
+
+  /*!
+      Change the initial time instant (translate the trajectory in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /*====== END SETTERS =========*/
+
+  /*====== TRANSFORM =========*/
+
+  using Position_Traj_Interface::changeFrame;
+
+  /*!
+      Change the reference frame of the trajectory
+      Apply an homogeneous transfrmation matrix to the trajectory
+      new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+  */
+  virtual void changeFrame(const TooN::Matrix<4, 4>& new_T_curr) override;
+
+  /*====== END TRANSFORM =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get the point at normalized arc length s (s is clamped in [0,1])
+  */
+  virtual TooN::Vector<3> getPointAt(double s) const;
+
+  /*!
+      Get Position at time secs
+  */
+  virtual TooN::Vector<3> getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual TooN::Vector<3> getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual TooN::Vector<3> getAcceleration(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Position_BSpline_Traj
+
+using Position_BSpline_Traj_Ptr = std::unique_ptr<Position_BSpline_Traj>;
+
+}  // namespace sun
+
+#endif
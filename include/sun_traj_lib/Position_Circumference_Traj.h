@@ -26,7 +26,7 @@
 #define POSITION_CIRCUMFERENCE_TRAJ_H
 
 #include "sun_traj_lib/Position_Traj_Interface.h"
-#include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
 
 namespace sun
 {
@@ -61,8 +61,9 @@ protected:
   /*!
       Trajectory for the scalar s variable should be a traj from 0 to final_angle
       s = 0 -> _pi   &   s = 1 -> _pf
+      Built-in profiles are stored inline (see Scalar_Traj_Variant)
   */
-  Scalar_Traj_Interface_Ptr _traj_s;
+  Scalar_Traj_Variant _traj_s;
 
 public:
   /*======CONSTRUCTORS========*/
@@ -91,11 +92,35 @@ public:
   */
   Position_Circumference_Traj(const Position_Circumference_Traj& traj);
 
+  /*!
+      Copy Constructor, a non built-in scalar traj is cloned in arena
+  */
+  Position_Circumference_Traj(const Position_Circumference_Traj& traj, Traj_Arena& arena);
+
+  /*!
+      Move Constructor
+  */
+  Position_Circumference_Traj(Position_Circumference_Traj&& traj) = default;
+
+  Position_Circumference_Traj& operator=(const Position_Circumference_Traj& traj) = default;
+
+  Position_Circumference_Traj& operator=(Position_Circumference_Traj&& traj) = default;
+
   /*!
       Clone the object in the heap
   */
   virtual Position_Circumference_Traj* clone() const override;
 
+  /*!
+      Clone the object in the arena
+  */
+  virtual Position_Circumference_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*!
+      Create in the heap a cursor placed at time secs, for streaming evaluation (see Position_Traj_Cursor)
+  */
+  virtual Position_Traj_Cursor* createCursor(double secs) const override;
+
   /*======END CONSTRUCTORS========*/
 
   /*====== GETTERS ========*/
@@ -156,6 +181,11 @@ public:
   */
   virtual void setScalarTraj(const Scalar_Traj_Interface& s_traj);
 
+  /*!
+      Set the scalar trajectory taking ownership of s_traj (no copy of a non built-in profile)
+  */
+  virtual void setScalarTraj(Scalar_Traj_Interface_Ptr&& s_traj);
+
   /*!
       Change the initial time instant (translate the trajectory in the time)
   */
@@ -0,0 +1,115 @@
+/*
+
+    Position Circumference Traj Cursor
+    Cursor of a circumference trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef POSITION_CIRCUMFERENCE_TRAJ_CURSOR_H
+#define POSITION_CIRCUMFERENCE_TRAJ_CURSOR_H
+
+#include "sun_traj_lib/Position_Traj_Cursor.h"
+#include "sun_traj_lib/Scalar_Traj_Cursor.h"
+#include "sun_traj_lib/Sin_Cos_Recurrence.h"
+
+namespace sun
+{
+//! Cursor of a Position_Circumference_Traj
+/*!
+    The angular profile is advanced by its own cursor and evaluated once per tick,
+    position, velocity and acceleration share a single sin/cos pair of the angle
+    (Position_Circumference_Traj evaluates the profile and sin/cos in each getter).
+    In recurrence mode (see setRecurrence()) advance() updates the sin/cos pair with a rotation recurrence
+    driven by the increment of the angle, without transcendental calls (see Sin_Cos_Recurrence).
+*/
+class Position_Circumference_Traj_Cursor : public Position_Traj_Cursor
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Position_Circumference_Traj_Cursor();
+
+protected:
+  /*!
+      Center of the circumference
+  */
+  TooN::Vector<3> _c;
+
+  /*!
+      First two columns of the rotation matrix of the circumference, scaled by the radius
+  */
+  TooN::Vector<3> _rho_x, _rho_y;
+
+  /*!
+      true if the circumference is a point
+  */
+  bool _is_a_point;
+
+  /*!
+      Cursor of the angular profile
+  */
+  Scalar_Traj_Cursor_Ptr _s_cursor;
+
+  /*!
+      sin and cos of the current angle
+  */
+  Sin_Cos_Recurrence _sin_cos;
+
+  /*!
+      true if advance() uses the recurrence
+  */
+  bool _recurrence;
+
+  /*!
+      Compute the state from the state of _s_cursor and _sin_cos
+  */
+  void updateState();
+
+public:
+  /*!
+      Constructor, the cursor is placed at time secs
+  */
+  Position_Circumference_Traj_Cursor(const TooN::Vector<3>& c, const TooN::Matrix<3, 3>& R, double rho,
+                                     const Scalar_Traj_Interface& traj_s, double secs);
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) override;
+
+  /*!
+      Move the cursor forward by dt
+  */
+  virtual void advance(double dt) override;
+
+  /*!
+      Enable/disable the recurrence mode of advance()
+      resync_period = steps between two exact evaluations (0 = never)
+      The max error w.r.t. Position_Circumference_Traj is reported in the benchmark
+      (sun_traj_lib_bench --filter=recurrence)
+  */
+  void setRecurrence(bool enable, int resync_period = SIN_COS_RECURRENCE_DEFAULT_RESYNC);
+
+};  // END CLASS Position_Circumference_Traj_Cursor
+
+}  // namespace sun
+
+#endif
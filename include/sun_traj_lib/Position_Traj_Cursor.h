@@ -0,0 +1,146 @@
+/*
+
+    Position Traj Cursor
+    Stateful evaluator of position trajs for streaming (monotonic time) queries
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef POSITION_TRAJ_CURSOR_H
+#define POSITION_TRAJ_CURSOR_H
+
+#include "sun_traj_lib/Position_Traj_Interface.h"
+
+namespace sun
+{
+//! Stateful evaluator of a position traj for streaming (monotonic time) queries
+/*!
+    A cursor is created by Position_Traj_Interface::createCursor(), it holds a snapshot of the traj
+    (later changes of the traj are not seen) and the state at the current time.
+    advance(dt) moves the cursor forward, derived cursors keep the current phase and any incremental state
+    so that the per-tick cost is (nearly) constant. seek() jumps to any time instant (also backward).
+    Cursors are created in the heap: create them outside the real-time loop, advance() and seek() do not allocate.
+    \sa Scalar_Traj_Cursor
+*/
+class Position_Traj_Cursor
+{
+protected:
+  /*!
+      Current time instant
+  */
+  double _time;
+
+  /*!
+      Position, Velocity and Acceleration at the current time instant
+  */
+  TooN::Vector<3> _position, _velocity, _acceleration;
+
+  /*!
+      Constructor of an unpositioned cursor (derived classes call seek())
+  */
+  Position_Traj_Cursor();
+
+public:
+  virtual ~Position_Traj_Cursor() = default;
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) = 0;
+
+  /*!
+      Move the cursor forward by dt (the same as seek(getTime() + dt))
+  */
+  virtual void advance(double dt);
+
+  /*====== END RUNNERS =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Current time instant
+  */
+  double getTime() const
+  {
+    return _time;
+  }
+
+  /*!
+      Position at the current time instant
+  */
+  const TooN::Vector<3>& getPosition() const
+  {
+    return _position;
+  }
+
+  /*!
+      Velocity at the current time instant
+  */
+  const TooN::Vector<3>& getVelocity() const
+  {
+    return _velocity;
+  }
+
+  /*!
+      Acceleration at the current time instant
+  */
+  const TooN::Vector<3>& getAcceleration() const
+  {
+    return _acceleration;
+  }
+
+  /*====== END GETTERS =========*/
+
+};  // END CLASS Position_Traj_Cursor
+
+using Position_Traj_Cursor_Ptr = std::unique_ptr<Position_Traj_Cursor>;
+
+//! Cursor of any position traj, it evaluates the getters of the traj at each tick
+class Position_Traj_Generic_Cursor : public Position_Traj_Cursor
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Position_Traj_Generic_Cursor();
+
+protected:
+  /*!
+      Copy of the traj
+  */
+  Position_Traj_Interface_Ptr _traj;
+
+public:
+  /*!
+      Constructor, the cursor is placed at time secs
+  */
+  Position_Traj_Generic_Cursor(const Position_Traj_Interface& traj, double secs);
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) override;
+
+};  // END CLASS Position_Traj_Generic_Cursor
+
+}  // namespace sun
+
+#endif
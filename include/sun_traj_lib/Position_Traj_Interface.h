@@ -31,6 +31,8 @@
 
 namespace sun
 {
+class Position_Traj_Cursor;
+
 //! Abstract class representing a Position traj (3D)
 class Position_Traj_Interface : public Traj_Generator_Interface
 {
@@ -61,6 +63,12 @@ public:
   */
   virtual Position_Traj_Interface* clone() const = 0;
 
+  /*!
+      Create in the heap a cursor placed at time secs, for streaming evaluation (see Position_Traj_Cursor)
+      The default cursor evaluates the getters at each tick
+  */
+  virtual Position_Traj_Cursor* createCursor(double secs) const;
+
   /*======END CONSTRUCTORS=========*/
 
   /*====== GETTERS =========*/
@@ -93,13 +101,11 @@ public:
       Change the reference frame of the trajectory
       Apply an homogeneous transfrmation matrix to the trajectory
       new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+      Not implemented by default: fatal error (if the fatal handler returns the traj is unchanged)
   */
   virtual void changeFrame(const TooN::Matrix<4, 4>& new_T_curr)
   {
-    std::cout << TRAJ_ERROR_COLOR "Error in Position_Traj_Interface::changeFrame( TooN::Matrix<4,4> new_T_curr ) | Not "
-                                  "implemented..." CRESET
-              << std::endl;
-    exit(-1);
+    trajFatal("Error in Position_Traj_Interface::changeFrame( TooN::Matrix<4,4> new_T_curr ) | Not implemented...");
   }
 
   /*!
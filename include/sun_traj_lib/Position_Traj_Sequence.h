@@ -0,0 +1,210 @@
+/*
+
+    Position Traj Sequence
+    Position traj made of a sequence of position trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef POSITION_TRAJ_SEQUENCE_H
+#define POSITION_TRAJ_SEQUENCE_H
+
+#include "sun_traj_lib/Position_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Result.h"
+#include "sun_traj_lib/Traj_Sequence_Index.h"
+
+namespace sun
+{
+//! Position traj made of a sequence of position trajs (e.g. Line_Segment_Traj and Position_Circumference_Traj)
+/*!
+    The segments are sorted by initial time, at time secs the last started segment is evaluated
+    (the first one before the start of the sequence, the last one after its end).
+    The active segment is found in O(log n), amortized O(1) for monotonic queries (see Traj_Sequence_Index).
+    The sequence must not be empty when it is evaluated.
+*/
+class Position_Traj_Sequence : public Position_Traj_Interface
+{
+private:
+  /*
+      Block access to these vars
+  */
+  double _initial_time, _final_time;
+
+protected:
+  /*!
+      Segments of the sequence
+  */
+  std::vector<Position_Traj_Interface_Ptr> _traj_vec;
+
+  /*!
+      Time index of the segments
+  */
+  Traj_Sequence_Index _index;
+
+  /* ====== CONSTRUCTORS =======*/
+
+public:
+  /*!
+      Void Constructor (empty sequence)
+  */
+  Position_Traj_Sequence();
+
+  /*!
+      Full constructor, the trajs have to be sorted by initial time
+  */
+  Position_Traj_Sequence(const std::vector<Position_Traj_Interface_Ptr>& traj_vec);
+
+  /*!
+      Copy Constructor
+  */
+  Position_Traj_Sequence(const Position_Traj_Sequence& traj);
+
+  /*!
+      Move Constructor
+  */
+  Position_Traj_Sequence(Position_Traj_Sequence&& traj) = default;
+
+  /*!
+      Blended path factory: linear segments through the waypoints joined by circular blends
+      The blend of the waypoint i starts and ends at distance min(blend_radius, half of the adjacent segments)
+      from the waypoint, the arc (Position_Circumference_Traj) is tangent to both segments.
+      The path is travelled at constant speed with continuous velocity at the joints (the acceleration jumps by
+      the centripetal term at the start and the end of a blend), the traj starts and ends at rest:
+      the speed ramps are on the first and the last segment.
+      speed is reduced so that the tangential acceleration of the ramps and the centripetal acceleration
+      of the blends are <= max_acceleration.
+      Less than 2 waypoints, coincident consecutive waypoints, a segment that reverses the previous one,
+      non positive or non finite blend_radius, speed or max_acceleration -> TRAJ_INVALID_ARGUMENT (no diagnostic)
+  */
+  static Traj_Result<Position_Traj_Sequence> createBlended(const std::vector<TooN::Vector<3> >& waypoints,
+                                                           double blend_radius, double speed,
+                                                           double max_acceleration, double initial_time = 0.0);
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Position_Traj_Sequence* clone() const override;
+
+  /* ====== END CONSTRUCTORS =======*/
+
+  /* ====== SETTERS =========*/
+
+  /*!
+      Push back a trajectory in the sequence
+      Its initial time has to be >= the initial time of the last segment,
+      otherwise the traj is discarded (error message) and false is returned
+  */
+  virtual bool push_back_traj(const Position_Traj_Interface& traj);
+
+  /*!
+      Remove last traj of the sequence
+  */
+  virtual void pop_back_traj();
+
+  /*!
+      Remove all the trajs of the sequence
+  */
+  virtual void clear();
+
+  /*!
+      Change the initial time instant (translate all the trajectories in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /*!
+      Set the mask of all the segments
+  */
+  virtual void setMask(TooN::Vector<3, int> mask) override;
+
+  /* ====== END SETTERS =========*/
+
+  /*====== TRANSFORM =========*/
+
+  using Position_Traj_Interface::changeFrame;
+
+  /*!
+      Change the reference frame of all the segments
+      new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+  */
+  virtual void changeFrame(const TooN::Matrix<4, 4>& new_T_curr) override;
+
+  /*====== END TRANSFORM =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Get the mask of the active segment at time secs
+  */
+  virtual TooN::Vector<3, int> getMask(double secs) const override;
+
+  /*!
+      Number of segments
+  */
+  virtual int size() const;
+
+  /*!
+      Get the i-th segment
+  */
+  virtual const Position_Traj_Interface& getTraj(int i) const;
+
+  /*!
+      Index of the active segment at time secs
+  */
+  virtual int getSegmentIndex(double secs) const;
+
+  /*!
+      Get the final time instant
+      It is the max final time
+  */
+  virtual double getFinalTime() const override;
+
+  /*!
+      Get the initial time instant
+      It is the initial time of the first segment
+  */
+  virtual double getInitialTime() const override;
+
+  /*====== END GETTERS =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual TooN::Vector<3> getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual TooN::Vector<3> getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual TooN::Vector<3> getAcceleration(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Position_Traj_Sequence
+
+using Position_Traj_Sequence_Ptr = std::unique_ptr<Position_Traj_Sequence>;
+
+}  // namespace sun
+
+#endif
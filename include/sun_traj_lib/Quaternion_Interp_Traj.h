@@ -0,0 +1,229 @@
+/*
+
+    Quaternion Interp Traj
+    Quaternion interpolation (slerp) driven by a scalar trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef QUATERNION_INTERP_TRAJ_H
+#define QUATERNION_INTERP_TRAJ_H
+
+#include "sun_traj_lib/Quaternion_Traj_Interface.h"
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
+
+namespace sun
+{
+//! Quaternion traj interpolating (slerp) two quaternions, driven by a scalar traj s from 0 to 1
+/*!
+    The log map of the rotation from the initial to the final quaternion (shortest path) is computed
+    in the constructor, so each sample is a sin/cos of the half angle and a linear combination:
+    q(s) = cos(s*angle/2) * q_i + sin(s*angle/2) * ([0, axis] * q_i)
+    (Rotation_Const_Axis_Traj computes an angvec and a quaternion product per sample).
+    The angular velocity/acceleration are ds/dt * angle * axis and d2s/dt2 * angle * axis (base frame).
+*/
+class Quaternion_Interp_Traj : public Quaternion_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Quaternion_Interp_Traj();
+
+  /*
+      Block access to these vars
+  */
+  double _initial_time, _final_time;
+
+protected:
+  /*!
+      Initial and final quaternion
+  */
+  UnitQuaternion _initial_quat, _final_quat;
+
+  /*!
+      [0, axis] * _initial_quat
+  */
+  UnitQuaternion _axis_quat;
+
+  /*!
+      Rotation axis (base frame) and angle from the initial to the final quaternion
+  */
+  TooN::Vector<3> _axis;
+  double _angle;
+
+  /*!
+      Trajectory of s, from 0 to 1
+  */
+  Scalar_Traj_Variant _traj_s;
+
+  /*!
+      Compute the log map from _initial_quat and _final_quat
+  */
+  void updateLogMap();
+
+public:
+  /*======CONSTRUCTORS=========*/
+
+  /*!
+      Full Constructor
+      s = 0 -> initial_quat   &   s = 1 -> final_quat
+  */
+  Quaternion_Interp_Traj(const UnitQuaternion& initial_quat, const UnitQuaternion& final_quat,
+                         const Scalar_Traj_Interface& traj_s);
+
+  /*!
+      Copy Constructor, a non built-in traj of s is cloned in arena
+  */
+  Quaternion_Interp_Traj(const Quaternion_Interp_Traj& traj, Traj_Arena& arena);
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Quaternion_Interp_Traj* clone() const override;
+
+  /*!
+      Clone the object in the arena
+  */
+  virtual Quaternion_Interp_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*======END CONSTRUCTORS=========*/
+
+  /*====== GETTERS =========*/
+
+  virtual UnitQuaternion getInitialQuat() const;
+
+  virtual UnitQuaternion getFinalQuat() const;
+
+  /*!
+      Get rotation axis (base frame), zero if initial and final quaternion are equal
+  */
+  virtual TooN::Vector<3> getAxis() const;
+
+  /*!
+      Get the total rotation angle in [0, pi]
+  */
+  virtual double getAngle() const;
+
+  /*!
+      Get the final time instant
+  */
+  virtual double getFinalTime() const override;
+
+  /*!
+      Get the initial time instant
+  */
+  virtual double getInitialTime() const override;
+
+  /*====== END GETTERS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Change the initial time instant (translate the trajectory in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /*!
+      Trajectory for the s variable should be a traj from 0 to 1
+  */
+  virtual void setScalarTraj(const Scalar_Traj_Interface& traj_s);
+
+  /*!
+      Set the s trajectory taking ownership of traj_s (no copy of a non built-in profile)
+  */
+  virtual void setScalarTraj(Scalar_Traj_Interface_Ptr&& traj_s);
+
+  /*====== END SETTERS =========*/
+
+  /*====== TRANSFORM =========*/
+
+  using Quaternion_Traj_Interface::changeFrame;
+
+  /*!
+      Change the reference frame of the trajectory
+      Apply a rotation matrix to the trajectory
+      new_R_curr is the rotation matrix of the current frame w.r.t. the new frame
+  */
+  virtual void changeFrame(const TooN::Matrix<3, 3>& new_R_curr) override;
+
+  /*!
+      Change the reference frame of the trajectory
+      Apply a rotation matrix to the trajectory
+      new_Q_curr is the Quaterion representing the rotation matrix of the current frame w.r.t. the new frame
+  */
+  virtual void changeFrame(const UnitQuaternion& new_Q_curr) override;
+
+  /*====== END TRANSFORM =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+       Get Quaternion at s
+  */
+  virtual UnitQuaternion getQuaternionAt(double s) const;
+
+  /*!
+       Get Quaternion at time secs
+  */
+  virtual UnitQuaternion getQuaternion(double secs) const override;
+
+  /*!
+      Get Angular Velocity at time secs
+  */
+  virtual TooN::Vector<3> getVelocity(double secs) const override;
+
+  /*!
+      Get Angular Acceleration at time secs
+  */
+  virtual TooN::Vector<3> getAcceleration(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+  /*====== QUATERNION MAPS =========*/
+
+  /*!
+      Exponential map of the pure quaternion [0, w]: [cos|w|, sin|w| w/|w|]
+  */
+  static UnitQuaternion exp(const TooN::Vector<3>& w);
+
+  /*!
+      Log map of a unit quaternion: w such that exp(w) = +-q, |w| in [0, pi/2] (shortest path)
+  */
+  static TooN::Vector<3> log(const UnitQuaternion& q);
+
+  /*!
+      Quaternion product, the result is not normalized
+  */
+  static UnitQuaternion product(const UnitQuaternion& q1, const UnitQuaternion& q2);
+
+  /*!
+      Dot product of the quaternions as 4-vectors
+  */
+  static double dot(const UnitQuaternion& q1, const UnitQuaternion& q2);
+
+  /*====== END QUATERNION MAPS =========*/
+
+};  // END CLASS Quaternion_Interp_Traj
+
+using Quaternion_Interp_Traj_Ptr = std::unique_ptr<Quaternion_Interp_Traj>;
+
+}  // namespace sun
+
+#endif
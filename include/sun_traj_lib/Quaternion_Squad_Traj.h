@@ -0,0 +1,204 @@
+/*
+
+    Quaternion Squad Traj
+    Smooth quaternion trajectory through waypoints (SQUAD) driven by a scalar trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef QUATERNION_SQUAD_TRAJ_H
+#define QUATERNION_SQUAD_TRAJ_H
+
+#include "sun_traj_lib/Quaternion_Interp_Traj.h"
+
+/*!
+    The derivatives of a segment of Quaternion_Squad_Traj use the Taylor series of the slerp of q^-1 a
+    when tan^2 of its angle is below this tolerance (the truncation error is O(angle^4))
+*/
+#define QUATERNION_SQUAD_SERIES_TOL 1.0e-10
+
+namespace sun
+{
+//! Smooth quaternion traj through N waypoints (SQUAD), driven by a scalar traj s from 0 to N-1
+/*!
+    s = i -> waypoint i, the segment i (s in [i, i+1]) is
+    squad(u) = slerp( slerp(q_i, q_i+1, u), slerp(a_i, a_i+1, u), 2u(1-u) ),  u = s - i
+    with the control quaternions a_i = q_i * exp( -( log(q_i^-1 q_i+1) + log(q_i^-1 q_i-1) ) / 4 )
+    (a_0 = q_0, a_N-1 = q_N-1), so the angular velocity is continuous at the waypoints if s is smooth.
+    The waypoints are aligned to the same hemisphere, the logs of the two inner slerps and the control quaternions
+    are computed in the constructor: a sample costs 3 exp and 1 log.
+    The angular velocity/acceleration (base frame) are computed from the exact derivatives of the segment
+    at the cost of about one sample (no numerical differentiation).
+*/
+class Quaternion_Squad_Traj : public Quaternion_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Quaternion_Squad_Traj();
+
+  /*
+      Block access to these vars
+  */
+  double _initial_time, _final_time;
+
+protected:
+  /*!
+      Waypoints q_i and control quaternions a_i
+  */
+  std::vector<UnitQuaternion> _waypoints, _controls;
+
+  /*!
+      log(q_i^-1 q_i+1) and log(a_i^-1 a_i+1) (one per segment)
+  */
+  std::vector<TooN::Vector<3> > _log_waypoints, _log_controls;
+
+  /*!
+      Trajectory of s, from 0 to N-1
+  */
+  Scalar_Traj_Variant _traj_s;
+
+  /*!
+      Compute the control quaternions and the logs from _waypoints
+  */
+  void updateControls();
+
+  /*!
+      Quaternion of the segment i at u (u is not clamped)
+  */
+  UnitQuaternion squad(int i, double u) const;
+
+  /*!
+      Segment of s and parameter in the segment
+  */
+  int segment(double s, double& u) const;
+
+  /*!
+      Angular velocity and acceleration (base frame) from the derivatives of q w.r.t. s
+  */
+  void getDerivatives(double secs, TooN::Vector<3>* velocity, TooN::Vector<3>* acceleration) const;
+
+public:
+  /*======CONSTRUCTORS=========*/
+
+  /*!
+      Full Constructor
+      waypoints: at least 2 quaternions, s = i -> waypoints[i]
+  */
+  Quaternion_Squad_Traj(const std::vector<UnitQuaternion>& waypoints, const Scalar_Traj_Interface& traj_s);
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Quaternion_Squad_Traj* clone() const override;
+
+  /*======END CONSTRUCTORS=========*/
+
+  /*====== GETTERS =========*/
+
+  virtual int getNumWaypoints() const;
+
+  /*!
+      Get the waypoint i (aligned to the hemisphere of the previous one)
+  */
+  virtual UnitQuaternion getWaypoint(int i) const;
+
+  /*!
+      Get the final time instant
+  */
+  virtual double getFinalTime() const override;
+
+  /*!
+      Get the initial time instant
+  */
+  virtual double getInitialTime() const override;
+
+  /*====== END GETTERS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Change the initial time instant (translate the trajectory in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /*!
+      Trajectory for the s variable should be a traj from 0 to N-1
+  */
+  virtual void setScalarTraj(const Scalar_Traj_Interface& traj_s);
+
+  /*!
+      Set the s trajectory taking ownership of traj_s (no copy of a non built-in profile)
+  */
+  virtual void setScalarTraj(Scalar_Traj_Interface_Ptr&& traj_s);
+
+  /*====== END SETTERS =========*/
+
+  /*====== TRANSFORM =========*/
+
+  using Quaternion_Traj_Interface::changeFrame;
+
+  /*!
+      Change the reference frame of the trajectory
+      Apply a rotation matrix to the trajectory
+      new_R_curr is the rotation matrix of the current frame w.r.t. the new frame
+  */
+  virtual void changeFrame(const TooN::Matrix<3, 3>& new_R_curr) override;
+
+  /*!
+      Change the reference frame of the trajectory
+      Apply a rotation matrix to the trajectory
+      new_Q_curr is the Quaterion representing the rotation matrix of the current frame w.r.t. the new frame
+  */
+  virtual void changeFrame(const UnitQuaternion& new_Q_curr) override;
+
+  /*====== END TRANSFORM =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+       Get Quaternion at s (s is clamped in [0, N-1])
+  */
+  virtual UnitQuaternion getQuaternionAt(double s) const;
+
+  /*!
+       Get Quaternion at time secs
+  */
+  virtual UnitQuaternion getQuaternion(double secs) const override;
+
+  /*!
+      Get Angular Velocity at time secs
+  */
+  virtual TooN::Vector<3> getVelocity(double secs) const override;
+
+  /*!
+      Get Angular Acceleration at time secs
+  */
+  virtual TooN::Vector<3> getAcceleration(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Quaternion_Squad_Traj
+
+using Quaternion_Squad_Traj_Ptr = std::unique_ptr<Quaternion_Squad_Traj>;
+
+}  // namespace sun
+
+#endif
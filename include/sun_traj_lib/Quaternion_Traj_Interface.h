@@ -105,13 +105,11 @@ public:
       Change the reference frame of the trajectory
       Apply a rotation matrix to the trajectory
       new_R_curr is the rotation matrix of the current frame w.r.t. the new frame
+      Not implemented by default: fatal error (if the fatal handler returns the traj is unchanged)
   */
   virtual void changeFrame(const TooN::Matrix<3, 3>& new_R_curr)
   {
-    std::cout << TRAJ_ERROR_COLOR "Error in Quaterion_Traj_Interface::changeFrame( TooN::Matrix<4,4> new_T_curr ) | "
-                                  "Not implemented..." CRESET
-              << std::endl;
-    exit(-1);
+    trajFatal("Error in Quaterion_Traj_Interface::changeFrame( TooN::Matrix<4,4> new_T_curr ) | Not implemented...");
   }
 
   /*!
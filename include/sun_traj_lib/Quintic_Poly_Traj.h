@@ -27,6 +27,7 @@
 
 #include "sun_math_toolbox/GeometryHelper.h"
 #include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Result.h"
 
 #define QUINTIC_POLY_EPS_TIME 0.001
 
@@ -74,6 +75,15 @@ public:
                     double initial_velocity = 0.0, double final_velocity = 0.0, double initial_acceleration = 0.0,
                     double final_acceleration = 0.0);
 
+  /*!
+      Non-fatal factory, validate the inputs and return the traj or an error status
+      A zero duration is accepted (the warning of the constructor is still sent to the diagnostic sink)
+  */
+  static Traj_Result<Quintic_Poly_Traj> create(double duration, double initial_position, double final_position,
+                                               double initial_time = 0.0, double initial_velocity = 0.0,
+                                               double final_velocity = 0.0, double initial_acceleration = 0.0,
+                                               double final_acceleration = 0.0);
+
   /*!
       Copy Constructor
   */
@@ -84,6 +94,11 @@ public:
   */
   virtual Quintic_Poly_Traj* clone() const override;
 
+  /*!
+      Clone the object in the arena
+  */
+  virtual Quintic_Poly_Traj* cloneInto(Traj_Arena& arena) const override;
+
   /*=======END CONSTRUCTORS======*/
 
   /*======= GETTERS =========*/
@@ -100,6 +115,11 @@ public:
 
   virtual double getFinalAcceleration() const;
 
+  /*!
+      Get poly coeff of p(t) (descending order, t measured from the initial time)
+  */
+  virtual TooN::Vector<6> getPolyCoeff() const;
+
   /*======= END GETTERS =========*/
 
   /*======SETTERS==========*/
@@ -126,17 +146,98 @@ public:
   /*!
       Get Position at time secs
   */
-  virtual double getPosition(double secs) const override;
+  virtual double getPosition(double secs) const override
+  {
+    if (secs < _initial_time)
+    {
+      return _pi;
+    }
+    if (secs > _final_time)
+    {
+      return _pf;
+    }
+    return polyval(_poly_coeff, secs - _initial_time);
+  }
 
   /*!
       Get Velocity at time secs
   */
-  virtual double getVelocity(double secs) const override;
+  virtual double getVelocity(double secs) const override
+  {
+    if (secs < _initial_time)
+    {
+      return 0.0;
+    }
+    if (secs > _final_time)
+    {
+      return 0.0;
+    }
+    return polyval(_vel_poly_coeff, secs - _initial_time);
+  }
 
   /*!
       Get Acceleration at time secs
   */
-  virtual double getAcceleration(double secs) const override;
+  virtual double getAcceleration(double secs) const override
+  {
+    if (secs < _initial_time)
+    {
+      return 0.0;
+    }
+    if (secs > _final_time)
+    {
+      return 0.0;
+    }
+    return polyval(_acc_poly_coeff, secs - _initial_time);
+  }
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  virtual Scalar_Traj_State getState(double secs) const override
+  {
+    Scalar_Traj_State state;
+    if (secs < _initial_time)
+    {
+      state.position = _pi;
+      state.velocity = 0.0;
+      state.acceleration = 0.0;
+      return state;
+    }
+    if (secs > _final_time)
+    {
+      state.position = _pf;
+      state.velocity = 0.0;
+      state.acceleration = 0.0;
+      return state;
+    }
+    double t = secs - _initial_time;
+    state.position = polyval(_poly_coeff, t);
+    state.velocity = polyval(_vel_poly_coeff, t);
+    state.acceleration = polyval(_acc_poly_coeff, t);
+    return state;
+  }
+
+  /*!
+      Get Position at the n time instants secs[0..n-1]
+  */
+  virtual void getPositionBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Velocity at the n time instants secs[0..n-1]
+  */
+  virtual void getVelocityBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Acceleration at the n time instants secs[0..n-1]
+  */
+  virtual void getAccelerationBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Position, Velocity and Acceleration at the n time instants secs[0..n-1]
+      Uses an AVX/SSE2 Horner kernel when available (see SUN_TRAJ_LIB_NATIVE_ARCH)
+  */
+  virtual void getStateBatch(const double* secs, double* pos, double* vel, double* acc, int n) const override;
 
   /*!
       Update poly coefficients
@@ -26,11 +26,17 @@
 #define ROTATION_CONST_AXIS_TRAJ_H
 
 #include "sun_traj_lib/Quaternion_Traj_Interface.h"
-#include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
 
 namespace sun
 {
 //! Quaternion traj representing a rotation about a constant axis
+/*!
+    The axis is constant, so [0, axis] * _initial_quat is cached:
+    Q(theta) = cos(theta/2) * _initial_quat + sin(theta/2) * ([0, axis] * _initial_quat)
+    i.e. a sample costs a sin/cos of the half angle and a linear combination (no angvec, no product).
+    The cache is updated by the constructors, setAxis(), setInitialQuat() and changeFrame().
+*/
 class Rotation_Const_Axis_Traj : public Quaternion_Traj_Interface
 {
 private:
@@ -53,11 +59,27 @@ protected:
   */
   UnitQuaternion _initial_quat;
 
+  /*!
+      Cache: [0, axis] * _initial_quat (= _initial_quat if the axis is zero)
+  */
+  UnitQuaternion _axis_quat;
+
+  /*!
+      Cache: true if the axis is zero (no rotation)
+  */
+  bool _zero_axis;
+
   /*!
       Trajectory for the angle variable should be a traj from theta_i to theta_f
       i.e. from the initial angle to the final angle
+      Built-in profiles are stored inline (see Scalar_Traj_Variant)
+  */
+  Scalar_Traj_Variant _traj_theta;
+
+  /*!
+      Update the cache from _axis and _initial_quat
   */
-  Scalar_Traj_Interface_Ptr _traj_theta;
+  void updateCache();
 
 public:
   /*======CONSTRUCTORS=========*/
@@ -73,11 +95,30 @@ public:
 
   Rotation_Const_Axis_Traj(const Rotation_Const_Axis_Traj& traj);
 
+  /*!
+      Copy Constructor, a non built-in angle traj is cloned in arena
+  */
+  Rotation_Const_Axis_Traj(const Rotation_Const_Axis_Traj& traj, Traj_Arena& arena);
+
+  /*!
+      Move Constructor
+  */
+  Rotation_Const_Axis_Traj(Rotation_Const_Axis_Traj&& traj) = default;
+
+  Rotation_Const_Axis_Traj& operator=(const Rotation_Const_Axis_Traj& traj) = default;
+
+  Rotation_Const_Axis_Traj& operator=(Rotation_Const_Axis_Traj&& traj) = default;
+
   /*!
       Clone the object in the heap
   */
   virtual Rotation_Const_Axis_Traj* clone() const override;
 
+  /*!
+      Clone the object in the arena
+  */
+  virtual Rotation_Const_Axis_Traj* cloneInto(Traj_Arena& arena) const override;
+
   /*======END CONSTRUCTORS=========*/
 
   /*====== GETTERS =========*/
@@ -127,6 +168,11 @@ public:
   */
   virtual void setScalarTraj(const Scalar_Traj_Interface& traj_theta);
 
+  /*!
+      Set the angle trajectory taking ownership of traj_theta (no copy of a non built-in profile)
+  */
+  virtual void setScalarTraj(Scalar_Traj_Interface_Ptr&& traj_theta);
+
   /*====== END SETTERS =========*/
 
   /*====== TRANSFORM =========*/
@@ -152,11 +198,17 @@ public:
   */
   virtual UnitQuaternion getDeltaQuat(double secs) const;
 
+  /*!
+       Get Quaternion at the angle theta
+  */
+  virtual UnitQuaternion getQuaternionAtAngle(double theta) const;
+
   /*!
        Get Quaternion at time secs
   */
   virtual UnitQuaternion getQuaternion(double secs) const override;
 
+
   /*!
       Get Angular Velocity at time secs
   */
@@ -167,6 +219,22 @@ public:
   */
   virtual TooN::Vector<3> getAcceleration(double secs) const override;
 
+  /*====== BATCH RUNNERS =========*/
+
+  /*!
+      Get Quaternion at the n angles thetas[0..n-1]
+      The result is written in out[0..n-1]
+  */
+  virtual void getQuaternionAtAngleBatch(const double* thetas, UnitQuaternion* out, int n) const;
+
+  /*!
+      Get Quaternion at the n time instants secs[0..n-1]
+      The result is written in out[0..n-1]
+  */
+  virtual void getQuaternionBatch(const double* secs, UnitQuaternion* out, int n) const;
+
+  /*====== END BATCH RUNNERS =========*/
+
 };  // END CLASS Rotation_Const_Axis_Traj
 
 using Rotation_Const_Axis_Traj_Ptr = std::unique_ptr<Rotation_Const_Axis_Traj>;
@@ -0,0 +1,180 @@
+/*
+
+    Sampled Cartesian Traj Class
+    Cartesian trajectory precomputed on a uniform time grid
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SAMPLED_CARTESIAN_TRAJ_H
+#define SAMPLED_CARTESIAN_TRAJ_H
+
+#include "sun_traj_lib/Cartesian_Traj_Interface.h"
+#include "sun_traj_lib/Sampled_Traj.h"
+
+namespace sun
+{
+//! Cartesian traj precomputed on a uniform time grid
+/*!
+    Pose and twist of a source traj are sampled once in the constructor,
+    then each query costs an index computation and an interpolation.
+    The position uses the linear velocity as derivative for SAMPLED_TRAJ_CUBIC,
+    the quaternion is normalized-linearly interpolated (the samples are stored on the same hemisphere),
+    the velocities are linearly interpolated (no acceleration is stored).
+    Outside [initial_time, final_time] the first/last sample is returned.
+*/
+class Sampled_Cartesian_Traj : public Cartesian_Traj_Interface
+{
+public:
+  /*!
+      Columns of the table
+  */
+  enum Column
+  {
+    COL_POSITION = 0,          //!< x, y, z
+    COL_QUATERNION = 3,        //!< s, v_x, v_y, v_z
+    COL_LINEAR_VELOCITY = 7,   //!< x, y, z
+    COL_ANGULAR_VELOCITY = 10, //!< x, y, z
+    NUM_COLUMNS = 13
+  };
+
+private:
+  /*!
+      No default Constructor
+  */
+  Sampled_Cartesian_Traj();
+
+protected:
+  /*!
+      Samples [p, q, v, w]
+  */
+  Sampled_Traj_Table _table;
+
+  /*!
+      Interpolation method
+  */
+  Sampled_Traj_Interpolation _interpolation;
+
+  /*!
+      Interpolate the 3 columns starting from c
+  */
+  TooN::Vector<3> interpolate3(int c, int dc, int k, double u) const;
+
+public:
+  /*======CONSTRUCTORS=========*/
+
+  /*!
+      Constructor, sample traj from its initial time to its final time with period sample_period
+      The mask of traj at the initial time is used
+  */
+  Sampled_Cartesian_Traj(const Cartesian_Traj_Interface& traj, double sample_period,
+                         Sampled_Traj_Interpolation interpolation = SAMPLED_TRAJ_LINEAR);
+
+  /*!
+      Constructor from a table with NUM_COLUMNS columns
+      A wrong table is a fatal error (see Traj_Fatal_Handler), if the handler returns a zero traj is built
+  */
+  Sampled_Cartesian_Traj(const Sampled_Traj_Table& table, double duration, double initial_time = 0.0,
+                         Sampled_Traj_Interpolation interpolation = SAMPLED_TRAJ_LINEAR);
+
+  /*!
+      Copy Constructor, the table is shared
+  */
+  Sampled_Cartesian_Traj(const Sampled_Cartesian_Traj& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Sampled_Cartesian_Traj* clone() const override;
+
+  /*======END CONSTRUCTORS=========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Get the table of samples
+  */
+  const Sampled_Traj_Table& getTable() const;
+
+  /*!
+      Get the interpolation method
+  */
+  Sampled_Traj_Interpolation getInterpolation() const;
+
+  /*====== END GETTERS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Set the interpolation method
+  */
+  void setInterpolation(Sampled_Traj_Interpolation interpolation);
+
+  /*====== END SETTERS =========*/
+
+  /*====== TRANSFORM =========*/
+
+  using Cartesian_Traj_Interface::changeFrame;
+
+  /*!
+      Change the reference frame of the trajectory
+      Apply an homogeneous transfrmation matrix to the trajectory
+      new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+      The samples are transformed (a shared table is copied first)
+  */
+  virtual void changeFrame(const TooN::Matrix<4, 4>& new_T_curr) override;
+
+  /*====== END TRANSFORM =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual TooN::Vector<3> getPosition(double secs) const override;
+
+  /*!
+      Get Quaternion at time secs
+  */
+  virtual UnitQuaternion getQuaternion(double secs) const override;
+
+  /*!
+      Get Linear Velocity at time secs
+  */
+  virtual TooN::Vector<3> getLinearVelocity(double secs) const override;
+
+  /*!
+      Get Angular Velocity at time secs
+  */
+  virtual TooN::Vector<3> getAngularVelocity(double secs) const override;
+
+  /*!
+      Get Twist Velocity at time secs [ v , w ]^T
+  */
+  virtual TooN::Vector<6> getTwist(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Sampled_Cartesian_Traj
+
+using Sampled_Cartesian_Traj_Ptr = std::unique_ptr<Sampled_Cartesian_Traj>;
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,151 @@
+/*
+
+    Sampled Scalar Traj Class
+    Scalar trajectory precomputed on a uniform time grid
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SAMPLED_SCALAR_TRAJ_H
+#define SAMPLED_SCALAR_TRAJ_H
+
+#include "sun_traj_lib/Sampled_Traj.h"
+#include "sun_traj_lib/Scalar_Traj_Interface.h"
+
+namespace sun
+{
+//! Scalar traj precomputed on a uniform time grid
+/*!
+    Position, velocity and acceleration of a source traj are sampled once in the constructor,
+    then each query costs an index computation and an interpolation.
+    Outside [initial_time, final_time] the first/last sample is returned.
+*/
+class Sampled_Scalar_Traj : public Scalar_Traj_Interface
+{
+public:
+  /*!
+      Columns of the table
+  */
+  enum Column
+  {
+    COL_POSITION,
+    COL_VELOCITY,
+    COL_ACCELERATION,
+    NUM_COLUMNS
+  };
+
+private:
+  /*!
+      No default Constructor
+  */
+  Sampled_Scalar_Traj();
+
+protected:
+  /*!
+      Samples [p, v, a]
+  */
+  Sampled_Traj_Table _table;
+
+  /*!
+      Interpolation method
+  */
+  Sampled_Traj_Interpolation _interpolation;
+
+public:
+  /*======CONSTRUCTORS=========*/
+
+  /*!
+      Constructor, sample traj from its initial time to its final time with period sample_period
+  */
+  Sampled_Scalar_Traj(const Scalar_Traj_Interface& traj, double sample_period,
+                      Sampled_Traj_Interpolation interpolation = SAMPLED_TRAJ_LINEAR);
+
+  /*!
+      Constructor from a table with NUM_COLUMNS columns
+      A wrong table is a fatal error (see Traj_Fatal_Handler), if the handler returns a zero traj is built
+  */
+  Sampled_Scalar_Traj(const Sampled_Traj_Table& table, double duration, double initial_time = 0.0,
+                      Sampled_Traj_Interpolation interpolation = SAMPLED_TRAJ_LINEAR);
+
+  /*!
+      Copy Constructor, the table is shared
+  */
+  Sampled_Scalar_Traj(const Sampled_Scalar_Traj& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Sampled_Scalar_Traj* clone() const override;
+
+  /*======END CONSTRUCTORS=========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Get the table of samples
+  */
+  const Sampled_Traj_Table& getTable() const;
+
+  /*!
+      Get the interpolation method
+  */
+  Sampled_Traj_Interpolation getInterpolation() const;
+
+  /*====== END GETTERS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Set the interpolation method
+  */
+  void setInterpolation(Sampled_Traj_Interpolation interpolation);
+
+  /*====== END SETTERS =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual double getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual double getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual double getAcceleration(double secs) const override;
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  virtual Scalar_Traj_State getState(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Sampled_Scalar_Traj
+
+using Sampled_Scalar_Traj_Ptr = std::unique_ptr<Sampled_Scalar_Traj>;
+
+}  // namespace sun
+
+#endif
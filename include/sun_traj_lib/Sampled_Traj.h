@@ -0,0 +1,250 @@
+/*
+
+    Sampled Traj
+    Uniform time-grid lookup table shared by the sampled trajectories
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SAMPLED_TRAJ_H
+#define SAMPLED_TRAJ_H
+
+#include <cmath>
+#include <memory>
+
+namespace sun
+{
+/*!
+    Interpolation used by the sampled trajectories between two consecutive samples
+*/
+enum Sampled_Traj_Interpolation
+{
+  SAMPLED_TRAJ_NEAREST,  //!< value of the nearest sample
+  SAMPLED_TRAJ_LINEAR,   //!< linear interpolation
+  SAMPLED_TRAJ_CUBIC     //!< cubic Hermite interpolation using the derivative column (when available)
+};
+
+//! Table of samples on a uniform time grid
+/*!
+    The table is stored column-major: column c is a contiguous array of getNumSamples() doubles,
+    sample k is taken at time k*getSamplePeriod() relative to the initial time of the owner traj.
+    The storage is shared and read only, so copies of the table (and of the sampled trajs) are cheap.
+    The storage can be owned by the table or provided from outside (e.g. a memory-mapped file).
+*/
+class Sampled_Traj_Table
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Sampled_Traj_Table();
+
+protected:
+  /*!
+      Storage of the samples (keeps the memory alive)
+  */
+  std::shared_ptr<const double> _storage;
+
+  /*!
+      Pointer to the first sample of the first column
+  */
+  const double* _data;
+
+  /*!
+      true if _storage was allocated by this class (i.e. it can be written in place)
+  */
+  bool _owned;
+
+  int _num_samples;
+  int _num_columns;
+  double _sample_period;
+  double _inv_sample_period;
+
+  /*!
+      Allocate an owned zero initialized storage
+  */
+  void allocate(int num_samples, int num_columns, double sample_period);
+
+  /*!
+      Make sure that the storage is owned and not shared before writing it (copy on write)
+  */
+  void makeUnique();
+
+public:
+  /*======CONSTRUCTORS=========*/
+
+  /*!
+      Constructor, allocate a zero initialized table
+      An invalid size is a fatal error (see Traj_Fatal_Handler), if the handler returns a 2-samples table is built
+  */
+  Sampled_Traj_Table(int num_samples, int num_columns, double sample_period);
+
+  /*!
+      Constructor from an external storage
+      storage has to point to num_samples*num_columns doubles (column-major), the memory is not copied
+  */
+  Sampled_Traj_Table(int num_samples, int num_columns, double sample_period, std::shared_ptr<const double> storage);
+
+  /*!
+      Copy Constructor, the storage is shared
+  */
+  Sampled_Traj_Table(const Sampled_Traj_Table& table) = default;
+
+  Sampled_Traj_Table& operator=(const Sampled_Traj_Table& table) = default;
+
+  /*======END CONSTRUCTORS=========*/
+
+  /*====== GETTERS =========*/
+
+  int getNumSamples() const
+  {
+    return _num_samples;
+  }
+
+  int getNumColumns() const
+  {
+    return _num_columns;
+  }
+
+  double getSamplePeriod() const
+  {
+    return _sample_period;
+  }
+
+  /*!
+      Get the read-only pointer to column c
+  */
+  const double* getColumn(int c) const
+  {
+    return _data + c * _num_samples;
+  }
+
+  /*!
+      Get a writable pointer to column c
+      If the storage is shared or external it is copied first
+  */
+  double* getMutableColumn(int c);
+
+  /*!
+      Get the storage (e.g. to keep it alive or to serialize it)
+  */
+  const std::shared_ptr<const double>& getStorage() const
+  {
+    return _storage;
+  }
+
+  /*====== END GETTERS =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Find the interval containing the time t (relative to the first sample)
+      out: k index of the first sample of the interval, u in [0,1] normalized position in the interval
+      t is saturated to the first and last sample
+  */
+  void locate(double t, int& k, double& u) const
+  {
+    double x = t * _inv_sample_period;
+    if (!(x > 0.0))  // also catches NAN
+    {
+      k = 0;
+      u = 0.0;
+    }
+    else if (x >= _num_samples - 1)
+    {
+      k = _num_samples - 2;
+      u = 1.0;
+    }
+    else
+    {
+      k = static_cast<int>(x);
+      u = x - k;
+    }
+  }
+
+  /*!
+      Value of the nearest sample of column c
+  */
+  double nearest(int c, int k, double u) const
+  {
+    return getColumn(c)[u < 0.5 ? k : k + 1];
+  }
+
+  /*!
+      Linear interpolation of column c
+  */
+  double linear(int c, int k, double u) const
+  {
+    const double* col = getColumn(c) + k;
+    return col[0] + u * (col[1] - col[0]);
+  }
+
+  /*!
+      Cubic Hermite interpolation of column c using column dc as its time derivative
+  */
+  double hermite(int c, int dc, int k, double u) const
+  {
+    const double* col = getColumn(c) + k;
+    const double* dcol = getColumn(dc) + k;
+    double u2 = u * u;
+    double u3 = u2 * u;
+    double h01 = 3.0 * u2 - 2.0 * u3;
+    double h10 = (u3 - 2.0 * u2 + u) * _sample_period;
+    double h11 = (u3 - u2) * _sample_period;
+    return col[0] + h01 * (col[1] - col[0]) + h10 * dcol[0] + h11 * dcol[1];
+  }
+
+  /*!
+      Interpolate column c using the method interp
+      dc is the column of the time derivative of c, used by SAMPLED_TRAJ_CUBIC (if dc < 0 linear is used)
+  */
+  double interpolate(Sampled_Traj_Interpolation interp, int c, int dc, int k, double u) const
+  {
+    switch (interp)
+    {
+      case SAMPLED_TRAJ_NEAREST:
+        return nearest(c, k, u);
+      case SAMPLED_TRAJ_CUBIC:
+        if (dc >= 0)
+          return hermite(c, dc, k, u);
+        return linear(c, k, u);
+      default:
+        return linear(c, k, u);
+    }
+  }
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Sampled_Traj_Table
+
+/*!
+    Number of samples needed to cover duration with the given sample period (at least 2)
+    return 0 if the duration is not finite (it can not be sampled)
+*/
+inline int sampledTrajNumSamples(double duration, double sample_period)
+{
+  if (!std::isfinite(duration) || !(sample_period > 0.0))
+    return 0;
+  int n = static_cast<int>(std::ceil(duration / sample_period - 1.0e-9)) + 1;
+  return n < 2 ? 2 : n;
+}
+
+}  // namespace sun
+
+#endif
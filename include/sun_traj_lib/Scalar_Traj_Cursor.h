@@ -0,0 +1,153 @@
+/*
+
+    Scalar Traj Cursor
+    Stateful evaluator of scalar trajs for streaming (monotonic time) queries
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SCALAR_TRAJ_CURSOR_H
+#define SCALAR_TRAJ_CURSOR_H
+
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
+
+namespace sun
+{
+//! Stateful evaluator of a scalar traj for streaming (monotonic time) queries
+/*!
+    A cursor is created by Scalar_Traj_Interface::createCursor(), it holds a snapshot of the traj
+    (later changes of the traj are not seen) and the state at the current time.
+    advance(dt) moves the cursor forward, derived cursors keep the current phase and any incremental state
+    so that the per-tick cost is (nearly) constant. seek() jumps to any time instant (also backward).
+    Cursors are created in the heap: create them outside the real-time loop, advance() and seek() do not allocate.
+*/
+class Scalar_Traj_Cursor
+{
+protected:
+  /*!
+      Current time instant
+  */
+  double _time;
+
+  /*!
+      State at the current time instant
+  */
+  Scalar_Traj_State _state;
+
+  /*!
+      Constructor of an unpositioned cursor (derived classes call seek())
+  */
+  Scalar_Traj_Cursor();
+
+public:
+  virtual ~Scalar_Traj_Cursor() = default;
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) = 0;
+
+  /*!
+      Move the cursor forward by dt (the same as seek(getTime() + dt))
+  */
+  virtual void advance(double dt);
+
+  /*====== END RUNNERS =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Current time instant
+  */
+  double getTime() const
+  {
+    return _time;
+  }
+
+  /*!
+      Position at the current time instant
+  */
+  double getPosition() const
+  {
+    return _state.position;
+  }
+
+  /*!
+      Velocity at the current time instant
+  */
+  double getVelocity() const
+  {
+    return _state.velocity;
+  }
+
+  /*!
+      Acceleration at the current time instant
+  */
+  double getAcceleration() const
+  {
+    return _state.acceleration;
+  }
+
+  /*!
+      Position, Velocity and Acceleration at the current time instant
+  */
+  const Scalar_Traj_State& getState() const
+  {
+    return _state;
+  }
+
+  /*====== END GETTERS =========*/
+
+};  // END CLASS Scalar_Traj_Cursor
+
+using Scalar_Traj_Cursor_Ptr = std::unique_ptr<Scalar_Traj_Cursor>;
+
+//! Cursor of any scalar traj, it evaluates getState() of the traj at each tick
+class Scalar_Traj_Generic_Cursor : public Scalar_Traj_Cursor
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Scalar_Traj_Generic_Cursor();
+
+protected:
+  /*!
+      Copy of the traj (built-in profiles are stored inline, see Scalar_Traj_Variant)
+  */
+  Scalar_Traj_Variant _traj;
+
+public:
+  /*!
+      Constructor, the cursor is placed at time secs
+  */
+  Scalar_Traj_Generic_Cursor(const Scalar_Traj_Interface& traj, double secs);
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) override;
+
+};  // END CLASS Scalar_Traj_Generic_Cursor
+
+}  // namespace sun
+
+#endif
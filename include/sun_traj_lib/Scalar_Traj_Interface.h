@@ -29,6 +29,16 @@
 
 namespace sun
 {
+class Scalar_Traj_Cursor;
+
+//! Position, velocity and acceleration of a scalar traj at a time instant
+struct Scalar_Traj_State
+{
+  double position;
+  double velocity;
+  double acceleration;
+};
+
 //! Abstract class representing a Scalar traj
 class Scalar_Traj_Interface : public Traj_Generator_Interface
 {
@@ -53,6 +63,12 @@ public:
   */
   virtual Scalar_Traj_Interface* clone() const = 0;
 
+  /*!
+      Create in the heap a cursor placed at time secs, for streaming evaluation (see Scalar_Traj_Cursor)
+      The default cursor evaluates getState() at each tick
+  */
+  virtual Scalar_Traj_Cursor* createCursor(double secs) const;
+
   /*====== END CONSTRUCTORS =========*/
 
   /*====== RUNNERS =========*/
@@ -72,8 +88,75 @@ public:
   */
   virtual double getAcceleration(double secs) const = 0;
 
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  virtual Scalar_Traj_State getState(double secs) const
+  {
+    Scalar_Traj_State state;
+    state.position = getPosition(secs);
+    state.velocity = getVelocity(secs);
+    state.acceleration = getAcceleration(secs);
+    return state;
+  }
+
   /*====== END RUNNERS =========*/
 
+  /*====== BATCH RUNNERS =========*/
+
+  /*!
+      Get Position at the n time instants secs[0..n-1]
+      The result is written in out[0..n-1]
+  */
+  virtual void getPositionBatch(const double* secs, double* out, int n) const
+  {
+    for (int i = 0; i < n; i++)
+    {
+      out[i] = getPosition(secs[i]);
+    }
+  }
+
+  /*!
+      Get Velocity at the n time instants secs[0..n-1]
+      The result is written in out[0..n-1]
+  */
+  virtual void getVelocityBatch(const double* secs, double* out, int n) const
+  {
+    for (int i = 0; i < n; i++)
+    {
+      out[i] = getVelocity(secs[i]);
+    }
+  }
+
+  /*!
+      Get Acceleration at the n time instants secs[0..n-1]
+      The result is written in out[0..n-1]
+  */
+  virtual void getAccelerationBatch(const double* secs, double* out, int n) const
+  {
+    for (int i = 0; i < n; i++)
+    {
+      out[i] = getAcceleration(secs[i]);
+    }
+  }
+
+  /*!
+      Get Position, Velocity and Acceleration at the n time instants secs[0..n-1]
+      The result is written in pos[0..n-1], vel[0..n-1] and acc[0..n-1]
+  */
+  virtual void getStateBatch(const double* secs, double* pos, double* vel, double* acc, int n) const
+  {
+    for (int i = 0; i < n; i++)
+    {
+      Scalar_Traj_State state = getState(secs[i]);
+      pos[i] = state.position;
+      vel[i] = state.velocity;
+      acc[i] = state.acceleration;
+    }
+  }
+
+  /*====== END BATCH RUNNERS =========*/
+
 };  // END CLASS Scalar_Traj_Interface
 
 using Scalar_Traj_Interface_Ptr = std::unique_ptr<Scalar_Traj_Interface>;
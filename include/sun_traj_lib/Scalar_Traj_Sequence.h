@@ -0,0 +1,172 @@
+/*
+
+    Scalar Traj Sequence
+    Scalar traj made of a sequence of scalar trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SCALAR_TRAJ_SEQUENCE_H
+#define SCALAR_TRAJ_SEQUENCE_H
+
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
+#include "sun_traj_lib/Traj_Sequence_Index.h"
+
+namespace sun
+{
+//! Scalar traj made of a sequence of scalar trajs
+/*!
+    The segments are sorted by initial time, at time secs the last started segment is evaluated
+    (the first one before the start of the sequence, the last one after its end).
+    The active segment is found in O(log n), amortized O(1) for monotonic queries (see Traj_Sequence_Index).
+    The sequence must not be empty when it is evaluated.
+*/
+class Scalar_Traj_Sequence : public Scalar_Traj_Interface
+{
+private:
+  /*
+      Block access to these vars
+  */
+  double _initial_time, _final_time;
+
+protected:
+  /*!
+      Segments of the sequence
+      Built-in profiles are stored inline (see Scalar_Traj_Variant)
+  */
+  std::vector<Scalar_Traj_Variant> _traj_vec;
+
+  /*!
+      Time index of the segments
+  */
+  Traj_Sequence_Index _index;
+
+  /* ====== CONSTRUCTORS =======*/
+
+public:
+  /*!
+      Void Constructor (empty sequence)
+  */
+  Scalar_Traj_Sequence();
+
+  /*!
+      Full constructor, the trajs have to be sorted by initial time
+  */
+  Scalar_Traj_Sequence(const std::vector<Scalar_Traj_Interface_Ptr>& traj_vec);
+
+  /*!
+      Copy Constructor
+  */
+  Scalar_Traj_Sequence(const Scalar_Traj_Sequence& traj);
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Scalar_Traj_Sequence* clone() const override;
+
+  /* ====== END CONSTRUCTORS =======*/
+
+  /* ====== SETTERS =========*/
+
+  /*!
+      Push back a trajectory in the sequence
+      Its initial time has to be >= the initial time of the last segment,
+      otherwise the traj is discarded (error message) and false is returned
+  */
+  virtual bool push_back_traj(const Scalar_Traj_Interface& traj);
+
+  /*!
+      Remove last traj of the sequence
+  */
+  virtual void pop_back_traj();
+
+  /*!
+      Remove all the trajs of the sequence
+  */
+  virtual void clear();
+
+  /*!
+      Change the initial time instant (translate all the trajectories in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /* ====== END SETTERS =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Number of segments
+  */
+  virtual int size() const;
+
+  /*!
+      Get the i-th segment
+  */
+  virtual const Scalar_Traj_Interface& getTraj(int i) const;
+
+  /*!
+      Index of the active segment at time secs
+  */
+  virtual int getSegmentIndex(double secs) const;
+
+  /*!
+      Get the final time instant
+      It is the max final time
+  */
+  virtual double getFinalTime() const override;
+
+  /*!
+      Get the initial time instant
+      It is the initial time of the first segment
+  */
+  virtual double getInitialTime() const override;
+
+  /*====== END GETTERS =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual double getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual double getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual double getAcceleration(double secs) const override;
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs (a single segment lookup)
+  */
+  virtual Scalar_Traj_State getState(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Scalar_Traj_Sequence
+
+using Scalar_Traj_Sequence_Ptr = std::unique_ptr<Scalar_Traj_Sequence>;
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,306 @@
+/*
+
+    Scalar Traj Variant Class
+    Value type storing the built-in scalar trajectories inline
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SCALAR_TRAJ_VARIANT_H
+#define SCALAR_TRAJ_VARIANT_H
+
+#include "sun_traj_lib/Quintic_Poly_Traj.h"
+#include "sun_traj_lib/Sine_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+#include "sun_traj_lib/Trapez_Traj.h"
+#include "sun_traj_lib/Trapez_Vel_Traj.h"
+
+/*!
+    Static dispatch on the stored type
+    the built-in types are called with a qualified (non virtual) call, defined in the header so that it can be inlined
+*/
+#define SCALAR_TRAJ_VARIANT_DISPATCH(method, ...)                                                                      \
+  switch (_type)                                                                                                       \
+  {                                                                                                                    \
+    case QUINTIC_POLY:                                                                                                 \
+      return _quintic_poly.Quintic_Poly_Traj::method(__VA_ARGS__);                                                     \
+    case TRAPEZ:                                                                                                       \
+      return _trapez.Trapez_Traj::method(__VA_ARGS__);                                                                 \
+    case TRAPEZ_VEL:                                                                                                   \
+      return _trapez_vel.Trapez_Vel_Traj::method(__VA_ARGS__);                                                         \
+    case SINE:                                                                                                         \
+      return _sine.Sine_Traj::method(__VA_ARGS__);                                                                     \
+    case GENERIC:                                                                                                      \
+      return _generic->method(__VA_ARGS__);                                                                            \
+    default:                                                                                                           \
+      break;                                                                                                           \
+  }
+
+namespace sun
+{
+//! Value type holding a scalar traj
+/*!
+    The built-in profiles (Quintic_Poly_Traj, Trapez_Traj, Trapez_Vel_Traj, Sine_Traj) are stored inline
+    and evaluated with static dispatch (no heap indirection, no virtual call, no allocation on copy).
+    Any other Scalar_Traj_Interface (including classes derived from the built-in ones) is cloned in the heap
+    and evaluated through the virtual interface (with the arena copy constructor it is cloned in a Traj_Arena).
+    The getters are defined in the header, so the dispatch is inlined in the caller
+    (and so are the Quintic_Poly_Traj runners, the other built-in runners are out of line calls).
+*/
+class Scalar_Traj_Variant
+{
+public:
+  /*!
+      Type of the stored traj
+  */
+  enum Type
+  {
+    EMPTY,
+    QUINTIC_POLY,
+    TRAPEZ,
+    TRAPEZ_VEL,
+    SINE,
+    GENERIC
+  };
+
+protected:
+  Type _type;
+
+  union
+  {
+    Quintic_Poly_Traj _quintic_poly;
+    Trapez_Traj _trapez;
+    Trapez_Vel_Traj _trapez_vel;
+    Sine_Traj _sine;
+  };
+
+  /*!
+      Storage for the GENERIC type (in the heap or in a Traj_Arena)
+  */
+  std::unique_ptr<Scalar_Traj_Interface, Traj_Deleter> _generic;
+
+  /*!
+      Construct the stored traj as a copy of traj (the variant must be EMPTY)
+  */
+  void construct(const Scalar_Traj_Interface& traj);
+
+  /*!
+      Move the traj stored in traj (the variant must be EMPTY), traj becomes EMPTY
+  */
+  void construct(Scalar_Traj_Variant&& traj);
+
+  /*!
+      Take ownership of traj (the variant must be EMPTY), traj becomes null
+  */
+  void construct(Scalar_Traj_Interface_Ptr&& traj);
+
+  /*!
+      Destroy the stored traj, the variant becomes EMPTY
+  */
+  void destroy();
+
+public:
+  /*======CONSTRUCTORS========*/
+
+  /*!
+      Empty Constructor
+  */
+  Scalar_Traj_Variant();
+
+  /*!
+      Constructor, store a copy of traj
+  */
+  Scalar_Traj_Variant(const Scalar_Traj_Interface& traj);
+
+  /*!
+      Copy Constructor
+  */
+  Scalar_Traj_Variant(const Scalar_Traj_Variant& traj);
+
+  /*!
+      Copy Constructor, a non built-in traj is cloned in arena (see Traj_Arena::clone())
+  */
+  Scalar_Traj_Variant(const Scalar_Traj_Variant& traj, Traj_Arena& arena);
+
+  /*!
+      Move Constructor, traj becomes EMPTY
+  */
+  Scalar_Traj_Variant(Scalar_Traj_Variant&& traj);
+
+  /*!
+      Constructor, take ownership of traj (null -> EMPTY)
+      A built-in profile is copied inline and deleted, any other traj is stored without cloning
+  */
+  Scalar_Traj_Variant(Scalar_Traj_Interface_Ptr&& traj);
+
+  ~Scalar_Traj_Variant();
+
+  Scalar_Traj_Variant& operator=(const Scalar_Traj_Variant& traj);
+
+  Scalar_Traj_Variant& operator=(Scalar_Traj_Variant&& traj);
+
+  Scalar_Traj_Variant& operator=(const Scalar_Traj_Interface& traj);
+
+  Scalar_Traj_Variant& operator=(Scalar_Traj_Interface_Ptr&& traj);
+
+  /*!
+      Clone the stored traj in the heap
+  */
+  Scalar_Traj_Interface* clone() const;
+
+  /*======END CONSTRUCTORS========*/
+
+  /*====== GETTERS ========*/
+
+  /*!
+      Get the type of the stored traj
+  */
+  Type getType() const
+  {
+    return _type;
+  }
+
+  /*!
+      true if no traj is stored
+  */
+  bool empty() const
+  {
+    return _type == EMPTY;
+  }
+
+  /*!
+      Get the stored traj (the variant must not be EMPTY)
+  */
+  const Scalar_Traj_Interface& get() const;
+
+  /*!
+      Get the stored traj (the variant must not be EMPTY)
+  */
+  Scalar_Traj_Interface& get();
+
+  /*!
+      Get the final time instant
+  */
+  double getFinalTime() const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(getFinalTime);
+    return NAN;
+  }
+
+  /*!
+      Get the initial time instant
+  */
+  double getInitialTime() const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(getInitialTime);
+    return NAN;
+  }
+
+  /*!
+      Get the duration
+  */
+  double getDuration() const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(getDuration);
+    return NAN;
+  }
+
+  /*!
+      return true if the trajectory is compleate at time secs
+  */
+  bool isCompleate(double secs) const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(isCompleate, secs);
+    return true;
+  }
+
+  /*!
+      return true if the trajectory is started at time secs
+  */
+  bool isStarted(double secs) const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(isStarted, secs);
+    return false;
+  }
+
+  /*====== END GETTERS ========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Change the initial time instant (translate the trajectory in the time)
+  */
+  void changeInitialTime(double initial_time)
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(changeInitialTime, initial_time);
+  }
+
+  /*====== END SETTERS =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs (NAN if EMPTY)
+  */
+  double getPosition(double secs) const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(getPosition, secs);
+    return NAN;
+  }
+
+  /*!
+      Get Velocity at time secs (NAN if EMPTY)
+  */
+  double getVelocity(double secs) const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(getVelocity, secs);
+    return NAN;
+  }
+
+  /*!
+      Get Acceleration at time secs (NAN if EMPTY)
+  */
+  double getAcceleration(double secs) const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(getAcceleration, secs);
+    return NAN;
+  }
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs (NAN if EMPTY)
+  */
+  Scalar_Traj_State getState(double secs) const
+  {
+    SCALAR_TRAJ_VARIANT_DISPATCH(getState, secs);
+    Scalar_Traj_State state;
+    state.position = NAN;
+    state.velocity = NAN;
+    state.acceleration = NAN;
+    return state;
+  }
+
+  /*====== END RUNNERS =========*/
+
+};  // END CLASS Scalar_Traj_Variant
+
+}  // namespace sun
+
+#undef SCALAR_TRAJ_VARIANT_DISPATCH
+
+#endif
@@ -0,0 +1,170 @@
+/*
+
+    Sin Cos Recurrence
+    Incremental evaluation of sin and cos of a slowly varying angle (no transcendental calls per tick)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SIN_COS_RECURRENCE_H
+#define SIN_COS_RECURRENCE_H
+
+#include <cmath>
+
+/*!
+    Max angle increment evaluated by the recurrence [rad], larger increments are computed with sin/cos
+    (the truncation error of the series of the increment is < 3e-17 below this value)
+*/
+#define SIN_COS_RECURRENCE_MAX_STEP 0.1
+
+/*!
+    Default number of recurrence steps between two exact evaluations
+*/
+#define SIN_COS_RECURRENCE_DEFAULT_RESYNC 1000
+
+/*!
+    Increments that differ by less than this value [rad] from the cached one are computed from the cached sin/cos
+    with a first order correction (the error is < 5e-17 below this value)
+*/
+#define SIN_COS_RECURRENCE_DELTA_TOL 1e-8
+
+namespace sun
+{
+//! sin and cos of an angle updated by a rotation recurrence
+/*!
+    update(angle) rotates the current (cos, sin) pair by the increment angle - previous angle:
+    the sin/cos of the increment come from their Taylor series (the increment is small at control rates)
+    and the pair is renormalized at each step, so the amplitude error stays at rounding level.
+    With a fixed dt the increment repeats, its sin/cos are cached and the series is skipped.
+    The phase error grows with the number of steps, an exact sin/cos evaluation is done every resync_period steps
+    (and on increments larger than SIN_COS_RECURRENCE_MAX_STEP) to bound it.
+*/
+class Sin_Cos_Recurrence
+{
+protected:
+  /*!
+      Current angle, sin and cos
+  */
+  double _angle, _sin, _cos;
+
+  /*!
+      Last increment computed by the series and its sin and cos
+  */
+  double _delta, _sin_d, _cos_d;
+
+  /*!
+      Steps between two exact evaluations (0 = never), steps since the last exact evaluation
+  */
+  int _resync_period, _steps;
+
+public:
+  /*!
+      Constructor, the current angle is angle
+  */
+  Sin_Cos_Recurrence(double angle = 0.0, int resync_period = SIN_COS_RECURRENCE_DEFAULT_RESYNC)
+    : _delta(0.0), _sin_d(0.0), _cos_d(1.0), _resync_period(resync_period)
+  {
+    reset(angle);
+  }
+
+  /*!
+      Set the current angle with an exact sin/cos evaluation
+  */
+  void reset(double angle)
+  {
+    _angle = angle;
+    _sin = std::sin(angle);
+    _cos = std::cos(angle);
+    _steps = 0;
+  }
+
+  /*!
+      Set the current angle with the recurrence
+  */
+  void update(double angle)
+  {
+    double delta = angle - _angle;
+    if (delta == 0.0)
+    {
+      return;
+    }
+    if (!(std::fabs(delta) <= SIN_COS_RECURRENCE_MAX_STEP) || (_resync_period > 0 && ++_steps >= _resync_period))
+    {
+      reset(angle);
+      return;
+    }
+    _angle = angle;
+
+    double sin_d, cos_d;
+    double delta_err = delta - _delta;
+    if (std::fabs(delta_err) <= SIN_COS_RECURRENCE_DELTA_TOL)
+    {
+      // same increment as the cached one up to rounding (fixed dt): first order correction of the cached sin/cos
+      sin_d = _sin_d + delta_err * _cos_d;
+      cos_d = _cos_d - delta_err * _sin_d;
+    }
+    else
+    {
+      // sin(delta) and cos(delta) series (Horner form, reciprocal coefficients)
+      double d2 = delta * delta;
+      sin_d = delta * (1.0 - d2 * (1.0 / 6.0) *
+                                 (1.0 - d2 * (1.0 / 20.0) * (1.0 - d2 * (1.0 / 42.0) * (1.0 - d2 * (1.0 / 72.0)))));
+      cos_d = 1.0 - d2 * 0.5 * (1.0 - d2 * (1.0 / 12.0) * (1.0 - d2 * (1.0 / 30.0) * (1.0 - d2 * (1.0 / 56.0))));
+      _delta = delta;
+      _sin_d = sin_d;
+      _cos_d = cos_d;
+    }
+
+    double s = _sin * cos_d + _cos * sin_d;
+    double c = _cos * cos_d - _sin * sin_d;
+
+    // renormalization: one Newton step of 1/sqrt(s^2 + c^2) around 1
+    double k = 1.5 - 0.5 * (s * s + c * c);
+    _sin = k * s;
+    _cos = k * c;
+  }
+
+  /*!
+      Set the steps between two exact evaluations (0 = never)
+  */
+  void setResyncPeriod(int resync_period)
+  {
+    _resync_period = resync_period;
+  }
+
+  double getAngle() const
+  {
+    return _angle;
+  }
+
+  double getSin() const
+  {
+    return _sin;
+  }
+
+  double getCos() const
+  {
+    return _cos;
+  }
+
+};  // END CLASS Sin_Cos_Recurrence
+
+}  // namespace sun
+
+#endif
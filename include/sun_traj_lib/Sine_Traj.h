@@ -26,6 +26,7 @@
 #define SINE_TRAJ_H
 
 #include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Result.h"
 
 namespace sun
 {
@@ -53,6 +54,12 @@ public:
   Sine_Traj(double duration, double amplitude, double frequency, double bias = 0.0, double phase = 0.0,
             double initial_time = 0.0);
 
+  /*!
+      Non-fatal factory, validate the inputs and return the traj or an error status
+  */
+  static Traj_Result<Sine_Traj> create(double duration, double amplitude, double frequency, double bias = 0.0,
+                                       double phase = 0.0, double initial_time = 0.0);
+
   /*!
       Copy Constructor
   */
@@ -63,6 +70,16 @@ public:
   */
   virtual Sine_Traj* clone() const override;
 
+  /*!
+      Clone the object in the arena
+  */
+  virtual Sine_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*!
+      Create in the heap a cursor placed at time secs, for streaming evaluation (see Scalar_Traj_Cursor)
+  */
+  virtual Scalar_Traj_Cursor* createCursor(double secs) const override;
+
   /*=======END CONSTRUCTORS======*/
 
   /*======= GETTERS =========*/
@@ -94,6 +111,26 @@ public:
   */
   virtual double getAcceleration(double secs) const override;
 
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  virtual Scalar_Traj_State getState(double secs) const override;
+
+  /*!
+      Get Position at the n time instants secs[0..n-1]
+  */
+  virtual void getPositionBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Velocity at the n time instants secs[0..n-1]
+  */
+  virtual void getVelocityBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Acceleration at the n time instants secs[0..n-1]
+  */
+  virtual void getAccelerationBatch(const double* secs, double* out, int n) const override;
+
 };  // END CLASS Sine_Traj
 
 using Sine_Traj_Ptr = std::unique_ptr<Sine_Traj>;
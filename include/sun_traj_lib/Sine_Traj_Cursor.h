@@ -0,0 +1,102 @@
+/*
+
+    Sine Traj Cursor
+    Cursor of a sinusoidal trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef SINE_TRAJ_CURSOR_H
+#define SINE_TRAJ_CURSOR_H
+
+#include "sun_traj_lib/Scalar_Traj_Cursor.h"
+#include "sun_traj_lib/Sin_Cos_Recurrence.h"
+
+namespace sun
+{
+//! Cursor of a Sine_Traj
+/*!
+    Position, velocity and acceleration are computed from a single sin/cos pair per tick
+    (Sine_Traj::getPosition/getVelocity/getAcceleration evaluate one transcendental each).
+    In recurrence mode (see setRecurrence()) advance() updates the sin/cos pair with a rotation recurrence,
+    without transcendental calls (see Sin_Cos_Recurrence).
+*/
+class Sine_Traj_Cursor : public Scalar_Traj_Cursor
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Sine_Traj_Cursor();
+
+protected:
+  /*!
+      initial time, final time, amplitude, pulse, phase, bias
+  */
+  double _ti, _tf, _A, _pulse, _phi, _bias;
+
+  /*!
+      sin and cos of the current phase
+  */
+  Sin_Cos_Recurrence _sin_cos;
+
+  /*!
+      true if advance() uses the recurrence
+  */
+  bool _recurrence;
+
+  /*!
+      Phase at time secs
+  */
+  double getPhase(double secs) const;
+
+  /*!
+      Compute the state from _sin_cos
+  */
+  void updateState();
+
+public:
+  /*!
+      Constructor, the cursor is placed at time secs
+  */
+  Sine_Traj_Cursor(double initial_time, double final_time, double amplitude, double pulse, double phase, double bias,
+                   double secs);
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) override;
+
+  /*!
+      Move the cursor forward by dt
+  */
+  virtual void advance(double dt) override;
+
+  /*!
+      Enable/disable the recurrence mode of advance()
+      resync_period = steps between two exact evaluations (0 = never)
+      The max error w.r.t. Sine_Traj is reported in the benchmark (sun_traj_lib_bench --filter=recurrence)
+  */
+  void setRecurrence(bool enable, int resync_period = SIN_COS_RECURRENCE_DEFAULT_RESYNC);
+
+};  // END CLASS Sine_Traj_Cursor
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,303 @@
+/*
+
+    Traj Arena
+    Monotonic buffer for allocation-free copies of trajectories
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAJ_ARENA_H
+#define TRAJ_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include "sun_traj_lib/Traj_Generator_Interface.h"
+
+namespace sun
+{
+/*!
+    Memory of a Traj_Arena (defined in Traj_Arena.cpp)
+    It is released by the arena or, if the arena is destroyed with blocks still in use, by the last deallocation
+*/
+struct Traj_Arena_Buffer;
+
+//! Deleter of the trajs allocated by a Traj_Arena (a null buffer = a traj of the heap, deleted as usual)
+class Traj_Deleter
+{
+protected:
+  /*!
+      Buffer of the arena
+  */
+  Traj_Arena_Buffer* _buffer;
+
+public:
+  Traj_Deleter() : _buffer(nullptr)
+  {
+  }
+
+  Traj_Deleter(Traj_Arena_Buffer* buffer) : _buffer(buffer)
+  {
+  }
+
+  /*!
+      Conversion from the default deleter (e.g. from the _Ptr aliases)
+  */
+  template <class T>
+  Traj_Deleter(const std::default_delete<T>&) : _buffer(nullptr)
+  {
+  }
+
+  template <class T>
+  void operator()(T* p) const;
+
+};  // END CLASS Traj_Deleter
+
+/*!
+    Owner of a traj allocated by a Traj_Arena (e.g. returned by Traj_Arena::clone())
+*/
+template <class T>
+using Traj_Arena_Unique_Ptr = std::unique_ptr<T, Traj_Deleter>;
+
+//! Monotonic buffer for the allocation of trajectories
+/*!
+    The arena is explicit: clone(traj) copies the traj in the preallocated buffer through
+    Traj_Generator_Interface::cloneInto(Traj_Arena&), the trajs that override it copy their children
+    (e.g. Cartesian_Independent_Traj, the non built-in profiles of a Scalar_Traj_Variant such as Double_S_Traj)
+    and their containers (e.g. Vector_Independent_Traj) in the arena too, the other trajs are cloned in the heap. The heap allocations (new/delete) of the trajs are not affected.
+    The trajs are owned by Traj_Arena_Unique_Ptr, deleting a traj of the arena does not free memory:
+    the buffer is reused by reset() when all its trajs are deleted.
+    If the buffer is full the allocation falls back to the heap (a warning is sent once until the next reset()).
+
+    The allocations and reset() have to be done in the same thread, the trajs can be deleted in any thread.
+    The arena has to outlive its trajs: destroying an arena with blocks still in use is a fatal error
+    (see Traj_Fatal_Handler), if the handler returns the buffer is released by the last deallocation.
+*/
+class Traj_Arena
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Traj_Arena();
+
+  Traj_Arena(const Traj_Arena&) = delete;
+  Traj_Arena& operator=(const Traj_Arena&) = delete;
+
+protected:
+  /*!
+      Preallocated buffer
+  */
+  Traj_Arena_Buffer* _buffer;
+
+public:
+  /*!
+      Constructor, preallocate capacity bytes
+  */
+  Traj_Arena(std::size_t capacity);
+
+  /*!
+      Destructor, all the trajs of the arena have to be already deleted
+  */
+  ~Traj_Arena();
+
+  /*!
+      Reuse the whole buffer
+      It fails (with an error message) if some traj of the arena is not deleted
+      return true on success
+  */
+  bool reset();
+
+  /*!
+      Clone traj (and the children that support it, see Traj_Generator_Interface::cloneInto()) in the arena
+  */
+  template <class T>
+  Traj_Arena_Unique_Ptr<T> clone(const T& traj);
+
+  /*!
+      Construct a T in the arena
+  */
+  template <class T, class... Args>
+  Traj_Arena_Unique_Ptr<T> create(Args&&... args);
+
+  /*!
+      Construct a T in the arena and return the raw pointer (used by the implementations of cloneInto())
+      The object has to be deleted by getDeleter()
+  */
+  template <class T, class... Args>
+  T* construct(Args&&... args);
+
+  /*!
+      Deleter of the objects of the arena
+  */
+  Traj_Deleter getDeleter() const
+  {
+    return Traj_Deleter(_buffer);
+  }
+
+  /*!
+      Buffer of the arena (see Traj_Deleter and Traj_Allocator)
+  */
+  Traj_Arena_Buffer* getBuffer() const
+  {
+    return _buffer;
+  }
+
+  /*====== GETTERS =========*/
+
+  std::size_t getCapacity() const;
+
+  std::size_t getUsed() const;
+
+  std::size_t getLiveBlocks() const;
+
+  /*====== END GETTERS =========*/
+
+  /*====== ALLOCATION =========*/
+
+  /*!
+      Allocate size bytes from buffer (from the heap if buffer is null or full)
+  */
+  static void* allocate(Traj_Arena_Buffer* buffer, std::size_t size);
+
+  /*!
+      Deallocate a block returned by allocate()
+      Thread safe: the count of the blocks in use is atomic
+  */
+  static void deallocate(Traj_Arena_Buffer* buffer, void* p);
+
+  /*====== END ALLOCATION =========*/
+
+};  // END CLASS Traj_Arena
+
+using Traj_Arena_Ptr = std::unique_ptr<Traj_Arena>;
+
+//! std allocator that uses a Traj_Arena (the heap if default constructed)
+/*!
+    Used by the containers of the trajs, so they are copied in the arena with the traj (see Vector_Independent_Traj)
+    A copy of the container (e.g. a clone() in the heap) uses the heap
+*/
+template <class T>
+class Traj_Allocator
+{
+protected:
+  /*!
+      Buffer of the arena, nullptr = heap
+  */
+  Traj_Arena_Buffer* _buffer;
+
+public:
+  typedef T value_type;
+
+  Traj_Allocator() : _buffer(nullptr)
+  {
+  }
+
+  Traj_Allocator(const Traj_Arena& arena) : _buffer(arena.getBuffer())
+  {
+  }
+
+  template <class U>
+  Traj_Allocator(const Traj_Allocator<U>& allocator) : _buffer(allocator.getBuffer())
+  {
+  }
+
+  Traj_Arena_Buffer* getBuffer() const
+  {
+    return _buffer;
+  }
+
+  T* allocate(std::size_t n)
+  {
+    return static_cast<T*>(Traj_Arena::allocate(_buffer, n * sizeof(T)));
+  }
+
+  void deallocate(T* p, std::size_t)
+  {
+    Traj_Arena::deallocate(_buffer, p);
+  }
+
+  /*!
+      The copies of a container are allocated in the heap
+  */
+  Traj_Allocator select_on_container_copy_construction() const
+  {
+    return Traj_Allocator();
+  }
+
+  template <class U>
+  struct rebind
+  {
+    typedef Traj_Allocator<U> other;
+  };
+
+};  // END CLASS Traj_Allocator
+
+template <class T, class U>
+bool operator==(const Traj_Allocator<T>& a, const Traj_Allocator<U>& b)
+{
+  return a.getBuffer() == b.getBuffer();
+}
+
+template <class T, class U>
+bool operator!=(const Traj_Allocator<T>& a, const Traj_Allocator<U>& b)
+{
+  return a.getBuffer() != b.getBuffer();
+}
+
+/*====== TEMPLATE IMPLEMENTATION =========*/
+
+template <class T>
+void Traj_Deleter::operator()(T* p) const
+{
+  if (!_buffer)
+  {
+    delete p;
+    return;
+  }
+  p->~T();
+  Traj_Arena::deallocate(_buffer, p);
+}
+
+template <class T>
+Traj_Arena_Unique_Ptr<T> Traj_Arena::clone(const T& traj)
+{
+  // through the base class: cloneInto() may be hidden by the overloads of T
+  return Traj_Arena_Unique_Ptr<T>(static_cast<T*>(static_cast<const Traj_Generator_Interface&>(traj).cloneInto(*this)),
+                                  getDeleter());
+}
+
+template <class T, class... Args>
+Traj_Arena_Unique_Ptr<T> Traj_Arena::create(Args&&... args)
+{
+  return Traj_Arena_Unique_Ptr<T>(construct<T>(std::forward<Args>(args)...), getDeleter());
+}
+
+template <class T, class... Args>
+T* Traj_Arena::construct(Args&&... args)
+{
+  return new (allocate(_buffer, sizeof(T))) T(std::forward<Args>(args)...);
+}
+
+/*====== END TEMPLATE IMPLEMENTATION =========*/
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,117 @@
+/*
+
+    Traj Cache File
+    Binary file format to store sampled trajectories and read them back with mmap (zero copy)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAJ_CACHE_FILE_H
+#define TRAJ_CACHE_FILE_H
+
+#include <cstdint>
+#include <string>
+#include "sun_traj_lib/Sampled_Cartesian_Traj.h"
+#include "sun_traj_lib/Sampled_Position_Traj.h"
+#include "sun_traj_lib/Sampled_Scalar_Traj.h"
+
+namespace sun
+{
+/*!
+    Type of traj stored in a cache file
+*/
+enum Traj_Cache_Type
+{
+  TRAJ_CACHE_SCALAR = 1,     //!< Sampled_Scalar_Traj columns
+  TRAJ_CACHE_POSITION = 2,   //!< Sampled_Position_Traj columns
+  TRAJ_CACHE_CARTESIAN = 3   //!< Sampled_Cartesian_Traj columns
+};
+
+//! Header of a traj cache file
+/*!
+    File layout (native byte order):
+    [ header (TRAJ_CACHE_HEADER_SIZE bytes) | column 0 | column 1 | ... ]
+    each column is num_samples doubles, the time grid is initial_time + k*sample_period, k = 0..num_samples-1
+    The columns are the ones of the Sampled_*_Traj class selected by type
+*/
+struct Traj_Cache_Header
+{
+  char magic[8];           //!< "SUNTRAJ"
+  uint32_t version;        //!< TRAJ_CACHE_VERSION
+  uint32_t byte_order;     //!< TRAJ_CACHE_BYTE_ORDER as written by the producer
+  uint32_t type;           //!< Traj_Cache_Type
+  uint32_t interpolation;  //!< Sampled_Traj_Interpolation
+  uint64_t num_samples;
+  uint64_t num_columns;
+  double initial_time;
+  double duration;
+  double sample_period;
+  int32_t mask[6];  //!< mask of position/cartesian trajs (unused entries are 1)
+};
+
+#define TRAJ_CACHE_MAGIC "SUNTRAJ"
+#define TRAJ_CACHE_VERSION 1
+#define TRAJ_CACHE_BYTE_ORDER 0x01020304
+#define TRAJ_CACHE_HEADER_SIZE 128  // the columns start 64-byte aligned in a mapped file
+
+static_assert(sizeof(Traj_Cache_Header) <= TRAJ_CACHE_HEADER_SIZE, "Traj_Cache_Header too big");
+
+/*!
+    Sample traj on a grid with period sample_period and write it in file_name
+    traj has to be a Scalar_Traj_Interface, a Position_Traj_Interface or a Cartesian_Traj_Interface
+    If traj is already a Sampled_*_Traj with the same period its table is written as it is
+    return false on error
+*/
+bool writeTrajCache(const std::string& file_name, const Traj_Generator_Interface& traj, double sample_period,
+                    Sampled_Traj_Interpolation interpolation = SAMPLED_TRAJ_LINEAR);
+
+/*!
+    Read the header of file_name
+    return false on error
+*/
+bool readTrajCacheHeader(const std::string& file_name, Traj_Cache_Header& header);
+
+/*!
+    Map file_name in memory and return the corresponding Sampled_*_Traj
+    The samples are not copied, the file stays mapped until the last traj using it is destroyed
+    return nullptr on error
+*/
+Traj_Generator_Interface_Ptr mapTrajCache(const std::string& file_name);
+
+/*!
+    Map a cache file storing a scalar traj (see mapTrajCache)
+    return nullptr on error or if the file stores another type of traj
+*/
+Sampled_Scalar_Traj_Ptr mapScalarTrajCache(const std::string& file_name);
+
+/*!
+    Map a cache file storing a position traj (see mapTrajCache)
+    return nullptr on error or if the file stores another type of traj
+*/
+Sampled_Position_Traj_Ptr mapPositionTrajCache(const std::string& file_name);
+
+/*!
+    Map a cache file storing a cartesian traj (see mapTrajCache)
+    return nullptr on error or if the file stores another type of traj
+*/
+Sampled_Cartesian_Traj_Ptr mapCartesianTrajCache(const std::string& file_name);
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,208 @@
+/*
+
+    Traj Diagnostic
+    Pluggable, real-time safe reporting of warnings and errors of the library
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAJ_DIAGNOSTIC_H
+#define TRAJ_DIAGNOSTIC_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#define TRAJ_ERROR_COLOR "\033[1m\033[31m" /* Bold Red */
+#define TRAJ_WARN_COLOR "\033[1m\033[33m"  /* Bold Yellow */
+#ifndef CRESET
+#define CRESET "\033[0m"
+#endif
+
+/*!
+    Max length of a diagnostic message (longer messages are truncated)
+*/
+#define TRAJ_DIAGNOSTIC_MSG_SIZE 256
+
+namespace sun
+{
+/*!
+    Severity of a diagnostic message
+*/
+enum Traj_Diagnostic_Level
+{
+  TRAJ_DIAG_INFO,
+  TRAJ_DIAG_WARN,
+  TRAJ_DIAG_ERROR,
+  TRAJ_DIAG_FATAL  //!< invalid input of a constructor, the fatal handler is called after the message
+};
+
+//! Destination of the diagnostic messages
+/*!
+    write() is called on the thread that generated the message (possibly a real-time thread),
+    a real-time safe sink must not block, allocate or perform syscalls
+*/
+class Traj_Diagnostic_Sink
+{
+public:
+  virtual ~Traj_Diagnostic_Sink() = default;
+
+  /*!
+      Handle the message msg (null terminated, at most TRAJ_DIAGNOSTIC_MSG_SIZE chars)
+  */
+  virtual void write(Traj_Diagnostic_Level level, const char* msg) = 0;
+
+};  // END CLASS Traj_Diagnostic_Sink
+
+//! Sink printing on stdout with colors (default sink, NOT real-time safe)
+class Traj_Console_Sink : public Traj_Diagnostic_Sink
+{
+public:
+  virtual void write(Traj_Diagnostic_Level level, const char* msg) override;
+
+};  // END CLASS Traj_Console_Sink
+
+//! Sink discarding all the messages
+class Traj_Null_Sink : public Traj_Diagnostic_Sink
+{
+public:
+  virtual void write(Traj_Diagnostic_Level /*level*/, const char* /*msg*/) override
+  {
+  }
+
+};  // END CLASS Traj_Null_Sink
+
+/*!
+    A diagnostic message stored by Traj_Ring_Buffer_Sink
+*/
+struct Traj_Diagnostic_Message
+{
+  Traj_Diagnostic_Level level;
+  char text[TRAJ_DIAGNOSTIC_MSG_SIZE];
+};
+
+//! Lock-free single-producer/single-consumer ring buffer sink
+/*!
+    write() (producer, e.g. the RT thread) copies the message in a preallocated slot without locks or syscalls,
+    pop()/drain() (consumer, e.g. a logging thread) read the messages in order.
+    If the buffer is full the message is dropped and counted (see getDroppedCount()).
+*/
+class Traj_Ring_Buffer_Sink : public Traj_Diagnostic_Sink
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Traj_Ring_Buffer_Sink();
+
+  Traj_Ring_Buffer_Sink(const Traj_Ring_Buffer_Sink&) = delete;
+  Traj_Ring_Buffer_Sink& operator=(const Traj_Ring_Buffer_Sink&) = delete;
+
+protected:
+  std::unique_ptr<Traj_Diagnostic_Message[]> _buffer;
+  std::size_t _capacity;
+
+  /*!
+      Next slot to read (written by the consumer only)
+  */
+  alignas(64) std::atomic<std::size_t> _head;
+
+  /*!
+      Next slot to write (written by the producer only)
+  */
+  alignas(64) std::atomic<std::size_t> _tail;
+
+  std::atomic<std::size_t> _dropped;
+
+public:
+  /*!
+      Constructor, preallocate capacity messages (it allocates, call it outside the RT loop)
+  */
+  Traj_Ring_Buffer_Sink(std::size_t capacity);
+
+  /*!
+      Producer side, store the message (dropped if the buffer is full)
+  */
+  virtual void write(Traj_Diagnostic_Level level, const char* msg) override;
+
+  /*!
+      Consumer side, pop the oldest message
+      return false if the buffer is empty
+  */
+  bool pop(Traj_Diagnostic_Message& msg);
+
+  /*!
+      Consumer side, forward all the stored messages to sink
+      return the number of forwarded messages
+  */
+  std::size_t drain(Traj_Diagnostic_Sink& sink);
+
+  /*!
+      Number of messages dropped because the buffer was full
+  */
+  std::size_t getDroppedCount() const;
+
+};  // END CLASS Traj_Ring_Buffer_Sink
+
+/*!
+    Function called after a TRAJ_DIAG_FATAL message.
+    The default handler calls exit(-1). If a custom handler returns, the object that raised the error
+    is left in a valid degenerate state (e.g. a trajectory that holds its initial position), as documented
+    in each constructor.
+*/
+typedef void (*Traj_Fatal_Handler)(const char* msg);
+
+/*!
+    Set the sink of the diagnostic messages (nullptr restores the default console sink)
+    The sink is not owned and has to outlive its use. The swap is atomic.
+*/
+void setTrajDiagnosticSink(Traj_Diagnostic_Sink* sink);
+
+/*!
+    Get the current diagnostic sink
+*/
+Traj_Diagnostic_Sink* getTrajDiagnosticSink();
+
+/*!
+    Set the fatal handler (nullptr restores the default exit(-1))
+*/
+void setTrajFatalHandler(Traj_Fatal_Handler handler);
+
+/*!
+    Send a printf-style message to the current sink
+    The message is formatted in a stack buffer (no allocations)
+*/
+void trajDiagnostic(Traj_Diagnostic_Level level, const char* format, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+/*!
+    Send a TRAJ_DIAG_FATAL printf-style message to the current sink, then call the fatal handler
+*/
+void trajFatal(const char* format, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 1, 2)))
+#endif
+    ;
+
+}  // namespace sun
+
+#endif
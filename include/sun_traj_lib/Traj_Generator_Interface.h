@@ -27,15 +27,12 @@
 
 #include <iostream>
 #include <memory>
-
-#define TRAJ_ERROR_COLOR "\033[1m\033[31m" /* Bold Red */
-#define TRAJ_WARN_COLOR "\033[1m\033[33m"  /* Bold Yellow */
-#ifndef CRESET
-#define CRESET "\033[0m"
-#endif
+#include "sun_traj_lib/Traj_Diagnostic.h"
 
 namespace sun
 {
+class Traj_Arena;
+
 //! General Interface for all traj generators
 class Traj_Generator_Interface
 {
@@ -61,26 +58,39 @@ public:
 
   /*!
       Constructor with duration and initial time as input
+      A negative duration is a fatal error (see Traj_Fatal_Handler), if the handler returns the duration is set to 0
   */
   Traj_Generator_Interface(double duration, double initial_time = 0.0) : _initial_time(initial_time)
   {
     if (duration < 0.0)
     {
-      std::cout << TRAJ_ERROR_COLOR "Error in Traj_Generator_Interface( double duration, double initial_time) duration "
-                                    "has to be >= 0" CRESET
-                << std::endl;
-      exit(-1);
+      trajFatal("Error in Traj_Generator_Interface( double duration, double initial_time) duration has to be >= 0");
+      duration = 0.0;
     }
     _final_time = _initial_time + duration;
   }
 
   // Traj_Generator_Interface( const Traj_Generator_Interface& traj );
 
+  /*!
+      Virtual destructor, trajs are owned and deleted through the interface pointers
+  */
+  virtual ~Traj_Generator_Interface() = default;
+
   /*!
       Clone the object in the heap
   */
   virtual Traj_Generator_Interface* clone() const = 0;
 
+  /*!
+      Clone the object in the arena (use Traj_Arena::clone(), the result is owned by a Traj_Arena_Unique_Ptr)
+      The default implementation clones the object in the heap
+  */
+  virtual Traj_Generator_Interface* cloneInto(Traj_Arena& /*arena*/) const
+  {
+    return clone();
+  }
+
   /*======END CONSTRUCTORS=========*/
 
   /*====== GETTERS =========*/
@@ -0,0 +1,145 @@
+/*
+
+    Traj Mailbox
+    Lock-free handoff of trajectories from a planner thread to a real-time thread
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAJ_MAILBOX_H
+#define TRAJ_MAILBOX_H
+
+#include <atomic>
+#include <utility>
+
+namespace sun
+{
+//! Lock-free single-writer/single-reader mailbox of trajectories (triple buffer)
+/*!
+    Ptr is an owning pointer, e.g. Cartesian_Traj_Interface_Ptr or Position_Traj_Interface_Ptr.
+
+    The writer (e.g. the planner) calls publish() with a new traj (typically obtained by clone()),
+    the reader (e.g. the 1 kHz control loop) calls update()/acquire() at each tick to switch to the last
+    published traj.
+    The three slots are preallocated: publish and switch are a single atomic exchange of a slot index,
+    the reader side never locks, allocates or destroys a traj.
+    A traj is destroyed only in publish(), on the writer side: the traj replaced by the reader, or a published
+    traj never taken by the reader (the reader always gets the last published one).
+
+    The traj returned by get()/acquire() is valid until the next call of update()/acquire() on the reader side.
+*/
+template <class Ptr>
+class Traj_Mailbox
+{
+public:
+  typedef typename Ptr::element_type element_type;
+
+private:
+  Traj_Mailbox(const Traj_Mailbox&) = delete;
+  Traj_Mailbox& operator=(const Traj_Mailbox&) = delete;
+
+  enum
+  {
+    INDEX_MASK = 3,
+    FRESH = 4  //!< the middle slot holds a traj not yet taken by the reader
+  };
+
+protected:
+  /*!
+      The three slots
+  */
+  Ptr _slots[3];
+
+  /*!
+      Index of the shared slot (| FRESH)
+  */
+  alignas(64) std::atomic<unsigned> _middle;
+
+  /*!
+      Slot owned by the writer
+  */
+  alignas(64) unsigned _back;
+
+  /*!
+      Slot owned by the reader
+  */
+  alignas(64) unsigned _front;
+
+public:
+  /*!
+      Constructor, empty mailbox (get() returns nullptr until the first publish)
+  */
+  Traj_Mailbox() : _middle(1), _back(2), _front(0)
+  {
+  }
+
+  /*====== WRITER SIDE =========*/
+
+  /*!
+      Publish traj, the reader switches to it at its next update()/acquire()
+      Destroys the traj released by the reader (or the previous traj if it was never taken)
+  */
+  void publish(Ptr traj)
+  {
+    _slots[_back] = std::move(traj);
+    _back = _middle.exchange(_back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    // the slot is not used by the reader anymore: reclaim it here
+    _slots[_back].reset();
+  }
+
+  /*====== END WRITER SIDE =========*/
+
+  /*====== READER SIDE (REAL-TIME SAFE) =========*/
+
+  /*!
+      Switch to the last published traj, if any
+      return true if a new traj has been taken
+  */
+  bool update()
+  {
+    if (!(_middle.load(std::memory_order_acquire) & FRESH))
+      return false;
+    _front = _middle.exchange(_front, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+  }
+
+  /*!
+      Current traj of the reader (nullptr if nothing has been published)
+  */
+  element_type* get() const
+  {
+    return _slots[_front].get();
+  }
+
+  /*!
+      update() and get()
+  */
+  element_type* acquire()
+  {
+    update();
+    return get();
+  }
+
+  /*====== END READER SIDE (REAL-TIME SAFE) =========*/
+
+};  // END CLASS Traj_Mailbox
+
+}  // namespace sun
+
+#endif
@@ -0,0 +1,213 @@
+/*
+
+    Traj Result
+    Status codes and expected-style result of the non-throwing trajectory factories
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAJ_RESULT_H
+#define TRAJ_RESULT_H
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sun
+{
+/*!
+    Outcome of a trajectory factory
+*/
+enum Traj_Status
+{
+  TRAJ_OK = 0,
+  TRAJ_INVALID_DURATION,      //!< negative or NaN duration
+  TRAJ_INVALID_CRUISE_SPEED,  //!< cruise speed not compatible with displacement and duration
+  TRAJ_INVALID_TIME,          //!< a derived time (e.g. acceleration time) is negative or NaN
+  TRAJ_INVALID_ARGUMENT       //!< any other invalid input
+};
+
+/*!
+    Human readable description of status
+*/
+inline const char* trajStatusString(Traj_Status status)
+{
+  switch (status)
+  {
+    case TRAJ_OK:
+      return "ok";
+    case TRAJ_INVALID_DURATION:
+      return "invalid duration";
+    case TRAJ_INVALID_CRUISE_SPEED:
+      return "invalid cruise speed";
+    case TRAJ_INVALID_TIME:
+      return "invalid time";
+    default:
+      return "invalid argument";
+  }
+}
+
+//! Either a value of type T or an error status (no exceptions, no heap)
+/*!
+    The value is built in place inside the result, so a factory can return a trajectory by value
+    without calling the (possibly fatal) validating constructor on invalid input.
+*/
+template <class T>
+class Traj_Result
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Traj_Result();
+
+protected:
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type _storage;
+  Traj_Status _status;
+
+  T* ptr()
+  {
+    return reinterpret_cast<T*>(&_storage);
+  }
+
+  const T* ptr() const
+  {
+    return reinterpret_cast<const T*>(&_storage);
+  }
+
+public:
+  /*======CONSTRUCTORS=========*/
+
+  /*!
+      Constructor of an error result (status != TRAJ_OK)
+  */
+  Traj_Result(Traj_Status status) : _status(status == TRAJ_OK ? TRAJ_INVALID_ARGUMENT : status)
+  {
+  }
+
+  /*!
+      Constructor of a valid result
+  */
+  Traj_Result(const T& value) : _status(TRAJ_OK)
+  {
+    new (&_storage) T(value);
+  }
+
+  /*!
+      Constructor of a valid result
+  */
+  Traj_Result(T&& value) : _status(TRAJ_OK)
+  {
+    new (&_storage) T(std::move(value));
+  }
+
+  /*!
+      Copy Constructor
+  */
+  Traj_Result(const Traj_Result& result) : _status(result._status)
+  {
+    if (result.ok())
+      new (&_storage) T(*result.ptr());
+  }
+
+  /*!
+      Move Constructor
+  */
+  Traj_Result(Traj_Result&& result) : _status(result._status)
+  {
+    if (result.ok())
+      new (&_storage) T(std::move(*result.ptr()));
+  }
+
+  ~Traj_Result()
+  {
+    if (ok())
+      ptr()->~T();
+  }
+
+  Traj_Result& operator=(const Traj_Result&) = delete;
+
+  /*======END CONSTRUCTORS=========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      true if the result holds a value
+  */
+  bool ok() const
+  {
+    return _status == TRAJ_OK;
+  }
+
+  explicit operator bool() const
+  {
+    return ok();
+  }
+
+  /*!
+      Get the status
+  */
+  Traj_Status status() const
+  {
+    return _status;
+  }
+
+  /*!
+      Get the value (only if ok())
+  */
+  T& value()
+  {
+    return *ptr();
+  }
+
+  /*!
+      Get the value (only if ok())
+  */
+  const T& value() const
+  {
+    return *ptr();
+  }
+
+  T& operator*()
+  {
+    return *ptr();
+  }
+
+  const T& operator*() const
+  {
+    return *ptr();
+  }
+
+  T* operator->()
+  {
+    return ptr();
+  }
+
+  const T* operator->() const
+  {
+    return ptr();
+  }
+
+  /*====== END GETTERS =========*/
+
+};  // END CLASS Traj_Result
+
+}  // namespace sun
+
+#endif
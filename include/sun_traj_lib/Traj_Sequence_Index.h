@@ -0,0 +1,187 @@
+/*
+
+    Traj Sequence Index
+    Time index of a sequence of trajs with O(log n) segment lookup
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAJ_SEQUENCE_INDEX_H
+#define TRAJ_SEQUENCE_INDEX_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace sun
+{
+//! Time index of a sequence of trajs
+/*!
+    Stores the sorted initial times of the segments of a sequence and finds the active segment at a given time.
+    The active segment is the last one started at time secs (the first one before the start of the sequence).
+    Lookups are O(log n) by binary search, a hint on the last found segment makes monotonic queries (the usual
+    control loop) amortized O(1).
+    The hint is a relaxed atomic, so concurrent const queries from different threads are safe.
+*/
+class Traj_Sequence_Index
+{
+protected:
+  /*!
+      Initial time of each segment (non-decreasing)
+  */
+  std::vector<double> _initial_times;
+
+  /*!
+      _final_times[i] is the max final time of the segments 0..i
+  */
+  std::vector<double> _final_times;
+
+  /*!
+      Last found segment
+  */
+  mutable std::atomic<std::size_t> _hint;
+
+public:
+  /*====== CONSTRUCTORS =========*/
+
+  /*!
+      Void Constructor (empty index)
+  */
+  Traj_Sequence_Index();
+
+  /*!
+      Copy Constructor
+  */
+  Traj_Sequence_Index(const Traj_Sequence_Index& index);
+
+  Traj_Sequence_Index& operator=(const Traj_Sequence_Index& index);
+
+  /*====== END CONSTRUCTORS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      return true if a segment starting at initial_time can be appended (i.e. the initial times stay sorted)
+  */
+  bool canPushBack(double initial_time) const;
+
+  /*!
+      Append a segment, initial_time has to satisfy canPushBack()
+  */
+  void push_back(double initial_time, double final_time);
+
+  /*!
+      Remove the last segment
+  */
+  void pop_back();
+
+  /*!
+      Remove all the segments
+  */
+  void clear();
+
+  /*!
+      Translate all the segments in the time by delta_time
+  */
+  void shift(double delta_time);
+
+  /*====== END SETTERS =========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      Number of segments
+  */
+  std::size_t size() const
+  {
+    return _initial_times.size();
+  }
+
+  bool empty() const
+  {
+    return _initial_times.empty();
+  }
+
+  /*!
+      Initial time of the sequence (NAN if empty)
+  */
+  double getInitialTime() const;
+
+  /*!
+      Final time of the sequence, i.e. the max final time of the segments (NAN if empty)
+  */
+  double getFinalTime() const;
+
+  /*!
+      Initial time of the i-th segment
+  */
+  double getSegmentInitialTime(std::size_t i) const
+  {
+    return _initial_times[i];
+  }
+
+  /*!
+      Index of the active segment at time secs
+      It is the last segment with initial time <= secs, 0 if secs is before the first segment
+      The index must not be empty
+  */
+  std::size_t find(double secs) const
+  {
+    const std::size_t n = _initial_times.size();
+    if (n < 2)
+      return 0;
+
+    const double* t = _initial_times.data();
+    std::size_t k = _hint.load(std::memory_order_relaxed);
+    if (k >= n)
+      k = 0;
+
+    if (secs >= t[k])
+    {
+      // same segment of the previous query
+      if (k + 1 == n || secs < t[k + 1])
+        return k;
+      // next segment (monotonic query)
+      if (k + 2 == n || secs < t[k + 2])
+      {
+        _hint.store(k + 1, std::memory_order_relaxed);
+        return k + 1;
+      }
+    }
+    else if (k == 0)
+    {
+      return 0;
+    }
+
+    // binary search: first segment with initial time > secs
+    k = std::upper_bound(t, t + n, secs) - t;
+    k = (k == 0) ? 0 : k - 1;
+    _hint.store(k, std::memory_order_relaxed);
+    return k;
+  }
+
+  /*====== END GETTERS =========*/
+
+};  // END CLASS Traj_Sequence_Index
+
+}  // namespace sun
+
+#endif
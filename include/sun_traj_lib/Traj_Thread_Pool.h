@@ -0,0 +1,152 @@
+/*
+
+    Traj Thread Pool
+    Pool of threads running parallel loops with work stealing
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAJ_THREAD_POOL_H
+#define TRAJ_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "sun_traj_lib/Aligned_Allocator.h"
+
+namespace sun
+{
+//! Pool of threads running parallel loops with work stealing
+/*!
+    parallelFor(n, ...) splits [0, n) in one range per thread, each thread consumes its range in chunks
+    and, when done, steals chunks from the ranges of the other threads.
+    Ranges are consumed with an atomic fetch_add, so owner and thieves never lock.
+    The calling thread works as thread 0: a pool of 1 thread runs the loop in the caller.
+    One parallelFor at a time (concurrent calls are serialized).
+*/
+class Traj_Thread_Pool
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Traj_Thread_Pool();
+
+  Traj_Thread_Pool(const Traj_Thread_Pool&) = delete;
+  Traj_Thread_Pool& operator=(const Traj_Thread_Pool&) = delete;
+
+public:
+  /*!
+      Body of a loop: process the indexes [begin, end)
+  */
+  typedef void (*Task)(void* context, std::size_t begin, std::size_t end);
+
+protected:
+  /*!
+      Range of indexes of a thread
+  */
+  struct alignas(64) Range
+  {
+    std::atomic<std::size_t> next;
+    std::size_t end;
+  };
+
+  unsigned int _num_threads;
+
+  /*!
+      One range per thread, on separate cache lines
+  */
+  std::vector<Range, Aligned_Allocator<Range, 64> > _ranges;
+
+  std::vector<std::thread> _workers;
+
+  /*!
+      Current loop
+  */
+  Task _task;
+  void* _context;
+  std::size_t _grain;
+
+  /*!
+      Synchronization of start and end of a loop
+  */
+  std::mutex _mutex, _call_mutex;
+  std::condition_variable _start_cv, _done_cv;
+  unsigned long _generation;
+  unsigned int _running_workers;
+  bool _stop;
+
+  /*!
+      num_threads, or std::thread::hardware_concurrency() if num_threads = 0
+  */
+  static unsigned int resolveNumThreads(unsigned int num_threads);
+
+  /*!
+      Main loop of the worker thread id
+  */
+  void workerLoop(unsigned int id);
+
+  /*!
+      Run the current loop as thread id
+  */
+  void work(unsigned int id);
+
+public:
+  /*!
+      Constructor, num_threads = 0 -> std::thread::hardware_concurrency()
+  */
+  Traj_Thread_Pool(unsigned int num_threads);
+
+  ~Traj_Thread_Pool();
+
+  unsigned int getNumThreads() const
+  {
+    return _num_threads;
+  }
+
+  /*!
+      Run task(context, begin, end) over [0, n) in chunks of at most grain indexes, return when all are done
+  */
+  void parallelFor(std::size_t n, Task task, void* context, std::size_t grain = 1);
+
+  /*!
+      Run f(i) for each i in [0, n), return when all are done
+  */
+  template <class F>
+  void parallelFor(std::size_t n, F& f, std::size_t grain = 1)
+  {
+    parallelFor(n,
+                [](void* context, std::size_t begin, std::size_t end) {
+                  for (std::size_t i = begin; i < end; i++)
+                    (*static_cast<F*>(context))(i);
+                },
+                &f, grain);
+  }
+
+};  // END CLASS Traj_Thread_Pool
+
+using Traj_Thread_Pool_Ptr = std::unique_ptr<Traj_Thread_Pool>;
+
+}  // namespace sun
+
+#endif
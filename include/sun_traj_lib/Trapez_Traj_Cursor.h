@@ -0,0 +1,102 @@
+/*
+
+    Trapez Traj Cursor
+    Cursor of a trapezoidal velocity profile with phase tracking
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef TRAPEZ_TRAJ_CURSOR_H
+#define TRAPEZ_TRAJ_CURSOR_H
+
+#include "sun_traj_lib/Scalar_Traj_Cursor.h"
+
+namespace sun
+{
+//! Cursor of a trapezoidal velocity profile (Trapez_Traj and Trapez_Vel_Traj)
+/*!
+    The current phase (before start, acceleration, cruise, deceleration, after end) is kept between ticks:
+    a forward query only checks the end of the current phase instead of all the phases from the start.
+*/
+class Trapez_Traj_Cursor : public Scalar_Traj_Cursor
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Trapez_Traj_Cursor();
+
+public:
+  /*!
+      Phases of the profile
+  */
+  enum Phase
+  {
+    BEFORE_START = 0,
+    ACCELERATION,
+    CRUISE,
+    DECELERATION,
+    AFTER_END
+  };
+
+protected:
+  /*!
+      initial time, initial position, final position, acceleration
+  */
+  double _ti, _pi, _pf, _ddp;
+
+  /*!
+      End of each phase, relative to _ti (_phase_end[AFTER_END] = INFINITY)
+  */
+  double _phase_end[5];
+
+  /*!
+      Current phase
+  */
+  int _phase;
+
+  /*!
+      Current time relative to _ti
+  */
+  double _t;
+
+public:
+  /*!
+      Constructor, the cursor is placed at time secs
+      acc_duration = duration of the acceleration (and deceleration) phase
+      duration = total duration of the profile
+  */
+  Trapez_Traj_Cursor(double initial_time, double initial_position, double final_position, double acceleration,
+                     double acc_duration, double duration, double secs);
+
+  /*!
+      Move the cursor to time secs
+  */
+  virtual void seek(double secs) override;
+
+  /*!
+      Current phase
+  */
+  Phase getPhase() const;
+
+};  // END CLASS Trapez_Traj_Cursor
+
+}  // namespace sun
+
+#endif
@@ -27,6 +27,7 @@
 
 #include <math.h>
 #include "sun_traj_lib/Scalar_Traj_Interface.h"
+#include "sun_traj_lib/Traj_Result.h"
 
 namespace sun
 {
@@ -54,12 +55,21 @@ public:
 
   /*!
       Constructor
+      Non valid times are a fatal error (see Traj_Fatal_Handler),
+      if the handler returns the traj holds the initial position
   */
   Trapez_Vel_Traj(
 
       double cruise_speed, double cruise_duration, double acceleration, double initial_position = 0.0,
       double initial_time = 0.0);
 
+  /*!
+      Non-fatal factory, validate the inputs and return the traj or an error status
+      No diagnostic is emitted, no heap allocation is performed
+  */
+  static Traj_Result<Trapez_Vel_Traj> create(double cruise_speed, double cruise_duration, double acceleration,
+                                             double initial_position = 0.0, double initial_time = 0.0);
+
   /*!
       Copy Constructor
   */
@@ -70,6 +80,16 @@ public:
   */
   virtual Trapez_Vel_Traj* clone() const override;
 
+  /*!
+      Clone the object in the arena
+  */
+  virtual Trapez_Vel_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*!
+      Create in the heap a cursor placed at time secs, for streaming evaluation (see Scalar_Traj_Cursor)
+  */
+  virtual Scalar_Traj_Cursor* createCursor(double secs) const override;
+
   /*=======END CONSTRUCTORS======*/
 
   /*======= GETTERS =========*/
@@ -99,6 +119,26 @@ public:
   */
   virtual double getAcceleration(double secs) const override;
 
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+  */
+  virtual Scalar_Traj_State getState(double secs) const override;
+
+  /*!
+      Get Position at the n time instants secs[0..n-1]
+  */
+  virtual void getPositionBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Velocity at the n time instants secs[0..n-1]
+  */
+  virtual void getVelocityBatch(const double* secs, double* out, int n) const override;
+
+  /*!
+      Get Acceleration at the n time instants secs[0..n-1]
+  */
+  virtual void getAccelerationBatch(const double* secs, double* out, int n) const override;
+
 };  // END CLASS Quintic_Poly_Traj
 
 using Trapez_Vel_Traj_Ptr = std::unique_ptr<Trapez_Vel_Traj>;
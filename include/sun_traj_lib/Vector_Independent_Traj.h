@@ -25,7 +25,9 @@
 #ifndef VECTOR_INDEPENDENT_TRAJ_H
 #define VECTOR_INDEPENDENT_TRAJ_H
 
-#include <sun_traj_lib/Scalar_Traj_Interface.h>
+#include <sun_traj_lib/Scalar_Traj_Variant.h>
+#include <sun_traj_lib/Traj_Arena.h>
+#include <sun_traj_lib/Traj_Result.h>
 #include <sun_traj_lib/Vector_Traj_Interface.h>
 
 namespace sun
@@ -42,8 +44,10 @@ private:
 protected:
   /*!
       std::vector containing the trajectories
+      Built-in profiles are stored inline (see Scalar_Traj_Variant),
+      the vector and the non built-in profiles are allocated in the arena of the traj (see cloneInto())
   */
-  std::vector<Scalar_Traj_Interface_Ptr> _traj_vec;
+  std::vector<Scalar_Traj_Variant, Traj_Allocator<Scalar_Traj_Variant> > _traj_vec;
 
   /* ====== CONSTRUCTORS =======*/
 
@@ -58,6 +62,11 @@ public:
   */
   Vector_Independent_Traj(const std::vector<Scalar_Traj_Interface_Ptr>& traj_vec);
 
+  /*!
+      Full constructor, take ownership of the trajs of traj_vec (no copy of non built-in profiles)
+  */
+  Vector_Independent_Traj(std::vector<Scalar_Traj_Interface_Ptr>&& traj_vec);
+
   /*!
       Constructor that creates n equal trajectories
   */
@@ -68,11 +77,44 @@ public:
   */
   Vector_Independent_Traj(const Vector_Independent_Traj& traj);
 
+  /*!
+      Copy Constructor, the vector of the trajs and the non built-in trajs are allocated in arena
+  */
+  Vector_Independent_Traj(const Vector_Independent_Traj& traj, Traj_Arena& arena);
+
+  /*!
+      Move Constructor
+  */
+  Vector_Independent_Traj(Vector_Independent_Traj&& traj) = default;
+
+  Vector_Independent_Traj& operator=(const Vector_Independent_Traj& traj) = default;
+
+  Vector_Independent_Traj& operator=(Vector_Independent_Traj&& traj) = default;
+
   /*!
       Clone the object in the heap
   */
   virtual Vector_Independent_Traj* clone() const override;
 
+  /*!
+      Clone the object and the vector of the trajs in the arena
+  */
+  virtual Vector_Independent_Traj* cloneInto(Traj_Arena& arena) const override;
+
+  /*!
+      Synchronized factory: minimum time trapezoidal velocity profiles (Trapez_Vel_Traj)
+      from initial_position to final_position that start and end together
+      |velocity_i| <= max_velocity[i] and |acceleration_i| <= max_acceleration[i]
+      All the joints share the acceleration time and the cruise duration (phase synchronization),
+      so the motion is a straight line in the joint space. The common duration is computed in closed form
+      Size mismatch, non positive or non finite limits -> TRAJ_INVALID_ARGUMENT (no diagnostic)
+  */
+  static Traj_Result<Vector_Independent_Traj> createSynchronized(const TooN::Vector<>& initial_position,
+                                                                 const TooN::Vector<>& final_position,
+                                                                 const TooN::Vector<>& max_velocity,
+                                                                 const TooN::Vector<>& max_acceleration,
+                                                                 double initial_time = 0.0);
+
   /* ====== END CONSTRUCTORS =======*/
 
   /* ====== SETTERS =========*/
@@ -82,6 +124,11 @@ public:
   */
   virtual void push_back_traj(const Scalar_Traj_Interface& traj);
 
+  /*!
+      Push back a trajectory in the vector taking ownership of traj
+  */
+  virtual void push_back_traj(Scalar_Traj_Interface_Ptr&& traj);
+
   /*!
       Remove last traj of the vector
   */
@@ -158,6 +205,32 @@ public:
 
   /*====== END RUNNERS =========*/
 
+protected:
+  /*====== ALLOCATION FREE HOOKS =========*/
+
+  /*!
+      Write Position at time secs in out
+  */
+  virtual void writePosition(double secs, double* out) const override;
+
+  /*!
+      Write Velocity at time secs in out
+  */
+  virtual void writeVelocity(double secs, double* out) const override;
+
+  /*!
+      Write Acceleration at time secs in out
+  */
+  virtual void writeAcceleration(double secs, double* out) const override;
+
+  /*!
+      Write Position, Velocity and Acceleration at time secs
+      in pos, vel and acc, a null pointer is skipped
+  */
+  virtual void writeState(double secs, double* pos, double* vel, double* acc) const override;
+
+  /*====== END ALLOCATION FREE HOOKS =========*/
+
 };  // END CLASS Vector_Independent_Traj
 
 using Vector_Independent_Traj_Ptr = std::unique_ptr<Vector_Independent_Traj>;
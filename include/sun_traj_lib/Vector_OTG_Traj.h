@@ -0,0 +1,186 @@
+/*
+
+    Vector OTG Traj
+    Vectorial trajectory for online trajectory generation (one OTG_Traj per joint)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef VECTOR_OTG_TRAJ_H
+#define VECTOR_OTG_TRAJ_H
+
+#include "sun_traj_lib/OTG_Traj.h"
+#include "sun_traj_lib/Vector_Traj_Interface.h"
+
+namespace sun
+{
+//! Vectorial Trajectory for Online Trajectory Generation (OTG), one OTG_Traj per joint
+/*!
+    Each joint moves with its own time-optimal profile (the joints are not synchronized).
+    The limits are stored in the traj, replan() computes the new profiles in place from the current state
+    (or from a measured state) to a new target: after the construction no heap allocation is performed.
+    \sa OTG_Traj
+*/
+class Vector_OTG_Traj : public Vector_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Vector_OTG_Traj();
+
+protected:
+  /*!
+      Limits of the joints
+  */
+  std::vector<double> _max_velocity, _max_acceleration;
+
+  /*!
+      Traj of the joints
+  */
+  std::vector<OTG_Traj> _joint_trajs;
+
+  /*!
+      Update the initial (min) and final (max) time from the joint trajs
+  */
+  void updateTimes();
+
+public:
+  /*======CONSTRUCTORS========*/
+
+  /*!
+      Constructor
+      Size mismatch is a fatal error (see Traj_Fatal_Handler),
+      if the handler returns the traj has the size of initial_position and holds it
+  */
+  Vector_OTG_Traj(const TooN::Vector<>& initial_position, const TooN::Vector<>& initial_velocity,
+                  const TooN::Vector<>& final_position, const TooN::Vector<>& max_velocity,
+                  const TooN::Vector<>& max_acceleration, double initial_time = 0.0);
+
+  /*!
+      Copy Constructor
+  */
+  Vector_OTG_Traj(const Vector_OTG_Traj& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Vector_OTG_Traj* clone() const override;
+
+  /*======END CONSTRUCTORS========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      get size of the vector
+  */
+  virtual int size() const;
+
+  /*!
+      Get the traj of joint i
+  */
+  virtual const OTG_Traj& getJointTraj(int i) const;
+
+  /*====== END GETTERS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Change the initial time instant (translate all the trajectories in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /*!
+      Set the limits, used by the next replan()
+      Non positive or non finite limits are rejected (error message): the limits are not changed and false is returned
+      Size mismatch is a fatal error, if the handler returns the limits are not changed and false is returned
+  */
+  virtual bool setLimits(const TooN::Vector<>& max_velocity, const TooN::Vector<>& max_acceleration);
+
+  /*====== END SETTERS =========*/
+
+  /*====== REPLAN =========*/
+
+  /*!
+      Replan from the state of the current traj at time secs to final_position (starting at secs)
+      Size mismatch is a fatal error, if the handler returns the traj is not changed
+  */
+  virtual void replan(double secs, const TooN::Vector<>& final_position);
+
+  /*!
+      Replan from the state (position, velocity) at time secs to final_position (starting at secs)
+      Size mismatch is a fatal error, if the handler returns the traj is not changed
+  */
+  virtual void replan(double secs, const TooN::Vector<>& position, const TooN::Vector<>& velocity,
+                      const TooN::Vector<>& final_position);
+
+  /*====== END REPLAN =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual TooN::Vector<> getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual TooN::Vector<> getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual TooN::Vector<> getAcceleration(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+protected:
+  /*====== ALLOCATION FREE HOOKS =========*/
+
+  /*!
+      Write Position at time secs in out
+  */
+  virtual void writePosition(double secs, double* out) const override;
+
+  /*!
+      Write Velocity at time secs in out
+  */
+  virtual void writeVelocity(double secs, double* out) const override;
+
+  /*!
+      Write Acceleration at time secs in out
+  */
+  virtual void writeAcceleration(double secs, double* out) const override;
+
+  /*!
+      Write Position, Velocity and Acceleration at time secs
+      in pos, vel and acc, a null pointer is skipped
+  */
+  virtual void writeState(double secs, double* pos, double* vel, double* acc) const override;
+
+  /*====== END ALLOCATION FREE HOOKS =========*/
+
+};  // END CLASS Vector_OTG_Traj
+
+using Vector_OTG_Traj_Ptr = std::unique_ptr<Vector_OTG_Traj>;
+
+}  // namespace sun
+
+#endif
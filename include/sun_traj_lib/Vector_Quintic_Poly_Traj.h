@@ -0,0 +1,199 @@
+/*
+
+    Vector Quintic Poly Traj Class
+    This class generates a vector trajectory of independent quintic polys (SoA layout)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef VECTOR_QUINTIC_POLY_TRAJ_H
+#define VECTOR_QUINTIC_POLY_TRAJ_H
+
+#include <vector>
+#include "sun_traj_lib/Aligned_Allocator.h"
+#include "sun_traj_lib/Quintic_Poly_Traj.h"
+#include "sun_traj_lib/Vector_Traj_Interface.h"
+
+namespace sun
+{
+//! Vectorial Trajectory made of independent Quintic Polys stored as Structure of Arrays
+/*!
+    All the joints are evaluated in a single (SIMD) pass over contiguous aligned coefficient arrays
+    \sa Vector_Independent_Traj, Quintic_Poly_Traj
+*/
+class Vector_Quintic_Poly_Traj : public Vector_Traj_Interface
+{
+private:
+  /*!
+      No default Constructor
+  */
+  Vector_Quintic_Poly_Traj();
+
+protected:
+  /*!
+      Number of joints
+  */
+  int _size;
+
+  /*!
+      Length of each column (_size rounded up to the SIMD width)
+  */
+  int _stride;
+
+  /*!
+      Columns of the SoA, each one of length _stride
+      ti, tf, pi, pf, p(t) coeffs (6), dp(t) coeffs (5), ddp(t) coeffs (4)
+  */
+  std::vector<double, Aligned_Allocator<double> > _data;
+
+  enum
+  {
+    COL_TI = 0,
+    COL_TF = 1,
+    COL_PI = 2,
+    COL_PF = 3,
+    COL_P = 4,
+    COL_V = COL_P + 6,
+    COL_A = COL_V + 5,
+    NUM_COLS = COL_A + 4
+  };
+
+  double* col(int c)
+  {
+    return _data.data() + c * _stride;
+  }
+
+  const double* col(int c) const
+  {
+    return _data.data() + c * _stride;
+  }
+
+  /*!
+      Allocate the columns and fill them from the joint trajs
+  */
+  void init(const std::vector<Quintic_Poly_Traj>& joint_trajs);
+
+public:
+  /*======CONSTRUCTORS========*/
+
+  /*!
+      Constructor, all the joints start at rest and end at rest
+      Size mismatch is a fatal error (see Traj_Fatal_Handler),
+      if the handler returns the traj has the size of initial_position and holds it
+  */
+  Vector_Quintic_Poly_Traj(double duration, const TooN::Vector<>& initial_position,
+                           const TooN::Vector<>& final_position, double initial_time = 0.0);
+
+  /*!
+      Full Constructor
+      Size mismatch is a fatal error, if the handler returns the traj has the size of initial_position and holds it
+  */
+  Vector_Quintic_Poly_Traj(double duration, const TooN::Vector<>& initial_position,
+                           const TooN::Vector<>& final_position, double initial_time,
+                           const TooN::Vector<>& initial_velocity, const TooN::Vector<>& final_velocity,
+                           const TooN::Vector<>& initial_acceleration, const TooN::Vector<>& final_acceleration);
+
+  /*!
+      Constructor from a vector of Quintic Polys, each one can have its own time interval
+  */
+  Vector_Quintic_Poly_Traj(const std::vector<Quintic_Poly_Traj>& joint_trajs);
+
+  /*!
+      Copy Constructor
+  */
+  Vector_Quintic_Poly_Traj(const Vector_Quintic_Poly_Traj& traj) = default;
+
+  /*!
+      Clone the object in the heap
+  */
+  virtual Vector_Quintic_Poly_Traj* clone() const override;
+
+  /*======END CONSTRUCTORS========*/
+
+  /*====== GETTERS =========*/
+
+  /*!
+      get size of the vector
+  */
+  virtual int size() const;
+
+  /*====== END GETTERS =========*/
+
+  /*====== SETTERS =========*/
+
+  /*!
+      Change the initial time instant (translate all the trajectories in the time)
+  */
+  virtual void changeInitialTime(double initial_time) override;
+
+  /*====== END SETTERS =========*/
+
+  /*====== RUNNERS =========*/
+
+  /*!
+      Get Position at time secs
+  */
+  virtual TooN::Vector<> getPosition(double secs) const override;
+
+  /*!
+      Get Velocity at time secs
+  */
+  virtual TooN::Vector<> getVelocity(double secs) const override;
+
+  /*!
+      Get Acceleration at time secs
+  */
+  virtual TooN::Vector<> getAcceleration(double secs) const override;
+
+  /*====== END RUNNERS =========*/
+
+protected:
+  /*====== ALLOCATION FREE HOOKS =========*/
+
+  /*!
+      Write Position at time secs in out
+  */
+  virtual void writePosition(double secs, double* out) const override;
+
+  /*!
+      Write Velocity at time secs in out
+  */
+  virtual void writeVelocity(double secs, double* out) const override;
+
+  /*!
+      Write Acceleration at time secs in out
+  */
+  virtual void writeAcceleration(double secs, double* out) const override;
+
+  /*!
+      Write Position, Velocity and Acceleration at time secs
+      Outputs are written in pos[0..size()-1], vel[0..size()-1] and acc[0..size()-1]
+      a null output pointer is skipped
+  */
+  virtual void writeState(double secs, double* pos, double* vel, double* acc) const override;
+
+  /*====== END ALLOCATION FREE HOOKS =========*/
+
+};  // END CLASS Vector_Quintic_Poly_Traj
+
+using Vector_Quintic_Poly_Traj_Ptr = std::unique_ptr<Vector_Quintic_Poly_Traj>;
+
+}  // namespace sun
+
+#endif
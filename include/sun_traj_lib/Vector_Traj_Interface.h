@@ -75,6 +75,139 @@ public:
 
   /*====== END RUNNERS =========*/
 
+  /*====== ALLOCATION FREE RUNNERS =========*/
+  /*
+      These runners write the result in a caller-provided buffer
+      the buffer must have the size of the vector traj
+      They have distinct names and are not virtual: derived classes override the protected write* hooks,
+      so they never hide these overloads
+  */
+
+  /*!
+      Get Position at time secs, the result is written in out
+  */
+  void getPositionInto(double secs, double* out) const
+  {
+    writePosition(secs, out);
+  }
+
+  /*!
+      Get Velocity at time secs, the result is written in out
+  */
+  void getVelocityInto(double secs, double* out) const
+  {
+    writeVelocity(secs, out);
+  }
+
+  /*!
+      Get Acceleration at time secs, the result is written in out
+  */
+  void getAccelerationInto(double secs, double* out) const
+  {
+    writeAcceleration(secs, out);
+  }
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs
+      The results are written in pos, vel and acc, a null pointer is skipped
+  */
+  void getStateInto(double secs, double* pos, double* vel, double* acc) const
+  {
+    writeState(secs, pos, vel, acc);
+  }
+
+  /*!
+      Get Position at time secs, the result is written in out (already sized)
+  */
+  void getPositionInto(double secs, TooN::Vector<>& out) const
+  {
+    writePosition(secs, out.get_data_ptr());
+  }
+
+  /*!
+      Get Velocity at time secs, the result is written in out (already sized)
+  */
+  void getVelocityInto(double secs, TooN::Vector<>& out) const
+  {
+    writeVelocity(secs, out.get_data_ptr());
+  }
+
+  /*!
+      Get Acceleration at time secs, the result is written in out (already sized)
+  */
+  void getAccelerationInto(double secs, TooN::Vector<>& out) const
+  {
+    writeAcceleration(secs, out.get_data_ptr());
+  }
+
+  /*!
+      Get Position, Velocity and Acceleration at time secs, the results are written in pos, vel and acc (already sized)
+  */
+  void getStateInto(double secs, TooN::Vector<>& pos, TooN::Vector<>& vel, TooN::Vector<>& acc) const
+  {
+    writeState(secs, pos.get_data_ptr(), vel.get_data_ptr(), acc.get_data_ptr());
+  }
+
+  /*====== END ALLOCATION FREE RUNNERS =========*/
+
+protected:
+  /*====== ALLOCATION FREE HOOKS =========*/
+  /*
+      The default implementations fall back to the allocating runners,
+      derived classes should override them
+  */
+
+  /*!
+      Write Position at time secs in out
+  */
+  virtual void writePosition(double secs, double* out) const
+  {
+    TooN::Vector<> v = getPosition(secs);
+    for (int i = 0; i < v.size(); i++)
+    {
+      out[i] = v[i];
+    }
+  }
+
+  /*!
+      Write Velocity at time secs in out
+  */
+  virtual void writeVelocity(double secs, double* out) const
+  {
+    TooN::Vector<> v = getVelocity(secs);
+    for (int i = 0; i < v.size(); i++)
+    {
+      out[i] = v[i];
+    }
+  }
+
+  /*!
+      Write Acceleration at time secs in out
+  */
+  virtual void writeAcceleration(double secs, double* out) const
+  {
+    TooN::Vector<> v = getAcceleration(secs);
+    for (int i = 0; i < v.size(); i++)
+    {
+      out[i] = v[i];
+    }
+  }
+
+  /*!
+      Write Position, Velocity and Acceleration at time secs in pos, vel and acc, a null pointer is skipped
+  */
+  virtual void writeState(double secs, double* pos, double* vel, double* acc) const
+  {
+    if (pos)
+      writePosition(secs, pos);
+    if (vel)
+      writeVelocity(secs, vel);
+    if (acc)
+      writeAcceleration(secs, acc);
+  }
+
+  /*====== END ALLOCATION FREE HOOKS =========*/
+
 };  // END CLASS Vector_Traj_Interface
 
 using Vector_Traj_Interface_Ptr = std::unique_ptr<Vector_Traj_Interface>;
@@ -25,6 +25,7 @@
 */
 
 #include "sun_traj_lib/COR_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
 
 using namespace TooN;
 using namespace std;
@@ -42,7 +43,7 @@ COR_Traj::COR_Traj(const Vector<3> &COR, const Vector<3> &normal, const Vector<3
   {
     if (norm(normal) < 10.0 * std::numeric_limits<double>::epsilon())
     {
-      cout << TRAJ_WARN_COLOR "[COR_Traj] WARNING: axis is zero -> no rotation" CRESET << endl;
+      trajDiagnostic(TRAJ_DIAG_WARN, "[COR_Traj] WARNING: axis is zero -> no rotation");
       _rot_axis = Zeros;
     }
     else
@@ -56,8 +57,8 @@ COR_Traj::COR_Traj(const Vector<3> &COR, const Vector<3> &normal, const Vector<3
   }
 }
 
-COR_Traj::COR_Traj(const UnitQuaternion &initial_quat, const Position_Circumference_Traj &circ_traj)
-  : Cartesian_Traj_Interface(NAN, NAN), _initial_quat(initial_quat), _pos_traj(circ_traj)
+COR_Traj::COR_Traj(const UnitQuaternion &initial_quat, Position_Circumference_Traj circ_traj)
+  : Cartesian_Traj_Interface(NAN, NAN), _initial_quat(initial_quat), _pos_traj(std::move(circ_traj))
 {
   if (_pos_traj.isAPoint())
   {
@@ -69,6 +70,17 @@ COR_Traj::COR_Traj(const UnitQuaternion &initial_quat, const Position_Circumfere
   }
 }
 
+/*
+    Copy Constructor, a non built-in angle traj is cloned in arena
+*/
+COR_Traj::COR_Traj(const COR_Traj &traj, Traj_Arena &arena)
+  : Cartesian_Traj_Interface(traj)
+  , _pos_traj(traj._pos_traj, arena)
+  , _rot_axis(traj._rot_axis)
+  , _initial_quat(traj._initial_quat)
+{
+}
+
 /*
     Clone the object in the heap
 */
@@ -77,6 +89,14 @@ COR_Traj *COR_Traj::clone() const
   return new COR_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+COR_Traj *COR_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<COR_Traj>(*this, arena);
+}
+
 /*======END CONSTRUCTORS=========*/
 
 /*====== GETTERS =========*/
@@ -41,6 +41,15 @@ Cartesian_Independent_Traj::Cartesian_Independent_Traj(const Position_Traj_Inter
 {
 }
 
+/*
+    Constructor, take ownership of pos_traj and quat_traj
+*/
+Cartesian_Independent_Traj::Cartesian_Independent_Traj(Position_Traj_Interface_Ptr &&pos_traj,
+                                                       Quaternion_Traj_Interface_Ptr &&quat_traj)
+  : Cartesian_Traj_Interface(NAN, NAN), _pos_traj(std::move(pos_traj)), _quat_traj(std::move(quat_traj))
+{
+}
+
 /*
     Copy Constructor
 */
@@ -49,6 +58,27 @@ Cartesian_Independent_Traj::Cartesian_Independent_Traj(const Cartesian_Independe
 {
 }
 
+/*
+    Copy Constructor, the children are cloned in arena
+*/
+Cartesian_Independent_Traj::Cartesian_Independent_Traj(const Cartesian_Independent_Traj &traj, Traj_Arena &arena)
+  : Cartesian_Traj_Interface(NAN, NAN)
+  , _pos_traj(arena.clone(*traj._pos_traj))
+  , _quat_traj(arena.clone(*traj._quat_traj))
+{
+}
+
+Cartesian_Independent_Traj &Cartesian_Independent_Traj::operator=(const Cartesian_Independent_Traj &traj)
+{
+  if (this != &traj)
+  {
+    Cartesian_Traj_Interface::operator=(traj);
+    _pos_traj.reset(traj._pos_traj->clone());
+    _quat_traj.reset(traj._quat_traj->clone());
+  }
+  return *this;
+}
+
 /*
     Clone the object in the heap
 */
@@ -57,6 +87,14 @@ Cartesian_Independent_Traj *Cartesian_Independent_Traj::clone() const
   return new Cartesian_Independent_Traj(*this);
 }
 
+/*
+    Clone the object and its children in the arena
+*/
+Cartesian_Independent_Traj *Cartesian_Independent_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Cartesian_Independent_Traj>(*this, arena);
+}
+
 /*======END CONSTRUCTORS=========*/
 
 /*====== GETTERS =========*/
@@ -112,6 +150,38 @@ void Cartesian_Independent_Traj::changeInitialTime(double initial_time)
   _quat_traj->changeInitialTime(_quat_traj->getInitialTime() - Delta_T);
 }
 
+/*
+    Set the position trajectory
+*/
+void Cartesian_Independent_Traj::setPositionTraj(const Position_Traj_Interface &pos_traj)
+{
+  _pos_traj.reset(pos_traj.clone());
+}
+
+/*
+    Set the position trajectory taking ownership of pos_traj
+*/
+void Cartesian_Independent_Traj::setPositionTraj(Position_Traj_Interface_Ptr &&pos_traj)
+{
+  _pos_traj = std::move(pos_traj);
+}
+
+/*
+    Set the quaternion trajectory
+*/
+void Cartesian_Independent_Traj::setQuaternionTraj(const Quaternion_Traj_Interface &quat_traj)
+{
+  _quat_traj.reset(quat_traj.clone());
+}
+
+/*
+    Set the quaternion trajectory taking ownership of quat_traj
+*/
+void Cartesian_Independent_Traj::setQuaternionTraj(Quaternion_Traj_Interface_Ptr &&quat_traj)
+{
+  _quat_traj = std::move(quat_traj);
+}
+
 /*====== END SETTERS =========*/
 
 /*====== TRANSFORM =========*/
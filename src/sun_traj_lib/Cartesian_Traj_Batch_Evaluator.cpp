@@ -0,0 +1,119 @@
+/*
+
+    Cartesian Traj Batch Evaluator
+    Parallel evaluation of many cartesian trajectories on a time grid
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Cartesian_Traj_Batch_Evaluator.h"
+
+using namespace std;
+using namespace TooN;
+
+namespace sun
+{
+/*====== SAMPLES =========*/
+
+/*
+    Constructor, preallocate num_trajs x num_times samples
+*/
+Cartesian_Traj_Samples::Cartesian_Traj_Samples(size_t num_trajs, size_t num_times) : _num_trajs(0), _num_times(0)
+{
+  resize(num_trajs, num_times);
+}
+
+/*
+    Resize to num_trajs x num_times samples, no allocation if the capacity is enough
+*/
+void Cartesian_Traj_Samples::resize(size_t num_trajs, size_t num_times)
+{
+  _num_trajs = num_trajs;
+  _num_times = num_times;
+  for (auto& column : _columns)
+  {
+    column.resize(num_trajs * num_times);
+  }
+}
+
+/*====== END SAMPLES =========*/
+
+/*
+    Constructor, num_threads = 0 -> std::thread::hardware_concurrency()
+*/
+Cartesian_Traj_Batch_Evaluator::Cartesian_Traj_Batch_Evaluator(unsigned int num_threads) : _pool(num_threads)
+{
+}
+
+/*
+    Evaluate trajs[i] at times[j] for all i,j
+*/
+void Cartesian_Traj_Batch_Evaluator::evaluate(const vector<const Cartesian_Traj_Interface*>& trajs,
+                                              const vector<double>& times, Cartesian_Traj_Samples& out,
+                                              bool relative_time)
+{
+  evaluate(trajs.size(), [&](size_t i) -> const Cartesian_Traj_Interface& { return *trajs[i]; }, times, out,
+           relative_time);
+}
+
+void Cartesian_Traj_Batch_Evaluator::evaluate(const vector<Cartesian_Traj_Interface_Ptr>& trajs,
+                                              const vector<double>& times, Cartesian_Traj_Samples& out,
+                                              bool relative_time)
+{
+  evaluate(trajs.size(), [&](size_t i) -> const Cartesian_Traj_Interface& { return *trajs[i]; }, times, out,
+           relative_time);
+}
+
+/*
+    Evaluate traj at times[j] for all j, write the samples of row traj_index of out
+*/
+void Cartesian_Traj_Batch_Evaluator::evaluateTraj(const Cartesian_Traj_Interface& traj, const vector<double>& times,
+                                                  Cartesian_Traj_Samples& out, size_t traj_index, bool relative_time)
+{
+  const double t0 = relative_time ? traj.getInitialTime() : 0.0;
+  const size_t offset = out.index(traj_index, 0);
+
+  double* cols[Cartesian_Traj_Samples::NUM_COLUMNS];
+  for (int c = 0; c < Cartesian_Traj_Samples::NUM_COLUMNS; c++)
+  {
+    cols[c] = out.column(c) + offset;
+  }
+
+  for (size_t j = 0; j < times.size(); j++)
+  {
+    double secs = t0 + times[j];
+
+    Vector<3> p = traj.getPosition(secs);
+    UnitQuaternion q = traj.getQuaternion(secs);
+    Vector<3> v = traj.getLinearVelocity(secs);
+    Vector<3> w = traj.getAngularVelocity(secs);
+    Vector<3> q_v = q.getV();
+
+    for (int k = 0; k < 3; k++)
+    {
+      cols[Cartesian_Traj_Samples::COL_POSITION + k][j] = p[k];
+      cols[Cartesian_Traj_Samples::COL_QUATERNION + 1 + k][j] = q_v[k];
+      cols[Cartesian_Traj_Samples::COL_LINEAR_VELOCITY + k][j] = v[k];
+      cols[Cartesian_Traj_Samples::COL_ANGULAR_VELOCITY + k][j] = w[k];
+    }
+    cols[Cartesian_Traj_Samples::COL_QUATERNION][j] = q.getS();
+  }
+}
+
+}  // namespace sun
@@ -0,0 +1,253 @@
+/*
+
+    Cartesian Traj Sequence
+    Cartesian traj made of a sequence of cartesian trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Cartesian_Traj_Sequence.h"
+
+using namespace TooN;
+
+namespace sun
+{
+/* ====== CONSTRUCTORS =======*/
+
+/*
+    Void Constructor (empty sequence)
+*/
+Cartesian_Traj_Sequence::Cartesian_Traj_Sequence() : Cartesian_Traj_Interface(NAN, NAN)
+{
+}
+
+/*
+    Full constructor
+*/
+Cartesian_Traj_Sequence::Cartesian_Traj_Sequence(const std::vector<Cartesian_Traj_Interface_Ptr>& traj_vec)
+  : Cartesian_Traj_Interface(NAN, NAN)
+{
+  _traj_vec.reserve(traj_vec.size());
+  for (const auto& element : traj_vec)
+  {
+    push_back_traj(*element);
+  }
+}
+
+/*
+    Copy Constructor
+*/
+Cartesian_Traj_Sequence::Cartesian_Traj_Sequence(const Cartesian_Traj_Sequence& traj)
+  : Cartesian_Traj_Interface(traj), _index(traj._index)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+  _traj_vec.reserve(traj._traj_vec.size());
+  for (const auto& element : traj._traj_vec)
+  {
+    _traj_vec.push_back(Cartesian_Traj_Interface_Ptr(element->clone()));
+  }
+}
+
+/*
+    Clone the object in the heap
+*/
+Cartesian_Traj_Sequence* Cartesian_Traj_Sequence::clone() const
+{
+  return new Cartesian_Traj_Sequence(*this);
+}
+
+/* ====== END CONSTRUCTORS =======*/
+
+/* ====== SETTERS =========*/
+
+/*
+    Push back a trajectory in the sequence
+*/
+bool Cartesian_Traj_Sequence::push_back_traj(const Cartesian_Traj_Interface& traj)
+{
+  if (!_index.canPushBack(traj.getInitialTime()))
+  {
+    trajDiagnostic(TRAJ_DIAG_ERROR,
+                   "Error in Cartesian_Traj_Sequence::push_back_traj() | initial time %f is before the last segment",
+                   traj.getInitialTime());
+    return false;
+  }
+  _traj_vec.push_back(Cartesian_Traj_Interface_Ptr(traj.clone()));
+  _index.push_back(traj.getInitialTime(), traj.getFinalTime());
+  return true;
+}
+
+/*
+    Remove last traj of the sequence
+*/
+void Cartesian_Traj_Sequence::pop_back_traj()
+{
+  _traj_vec.pop_back();
+  _index.pop_back();
+}
+
+/*
+    Remove all the trajs of the sequence
+*/
+void Cartesian_Traj_Sequence::clear()
+{
+  _traj_vec.clear();
+  _index.clear();
+}
+
+/*
+    Change the initial time instant (translate all the trajectories in the time)
+*/
+void Cartesian_Traj_Sequence::changeInitialTime(double initial_time)
+{
+  double Delta_T = initial_time - getInitialTime();
+  for (auto& element : _traj_vec)
+  {
+    element->changeInitialTime(element->getInitialTime() + Delta_T);
+  }
+  _index.shift(Delta_T);
+}
+
+/*
+    Set the mask of all the segments
+*/
+void Cartesian_Traj_Sequence::setMask(Vector<6, int> mask)
+{
+  Cartesian_Traj_Interface::setMask(mask);
+  for (auto& element : _traj_vec)
+  {
+    element->setMask(mask);
+  }
+}
+
+/* ====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of all the segments
+*/
+void Cartesian_Traj_Sequence::changeFrame(const Matrix<4, 4>& new_T_curr)
+{
+  for (auto& element : _traj_vec)
+  {
+    element->changeFrame(new_T_curr);
+  }
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Get the mask of the active segment at time secs
+*/
+Vector<6, int> Cartesian_Traj_Sequence::getMask(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getMask(secs);
+}
+
+/*
+    Number of segments
+*/
+int Cartesian_Traj_Sequence::size() const
+{
+  return _traj_vec.size();
+}
+
+/*
+    Get the i-th segment
+*/
+const Cartesian_Traj_Interface& Cartesian_Traj_Sequence::getTraj(int i) const
+{
+  return *_traj_vec[i];
+}
+
+/*
+    Index of the active segment at time secs
+*/
+int Cartesian_Traj_Sequence::getSegmentIndex(double secs) const
+{
+  return _index.find(secs);
+}
+
+/*
+    Get the final time instant
+*/
+double Cartesian_Traj_Sequence::getFinalTime() const
+{
+  return _index.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Cartesian_Traj_Sequence::getInitialTime() const
+{
+  return _index.getInitialTime();
+}
+
+/*====== END GETTERS =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Position at time secs
+*/
+Vector<3> Cartesian_Traj_Sequence::getPosition(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getPosition(secs);
+}
+
+/*
+    Get Quaternion at time secs
+*/
+UnitQuaternion Cartesian_Traj_Sequence::getQuaternion(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getQuaternion(secs);
+}
+
+/*
+    Get Linear Velocity at time secs
+*/
+Vector<3> Cartesian_Traj_Sequence::getLinearVelocity(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getLinearVelocity(secs);
+}
+
+/*
+    Get Angular Velocity at time secs
+*/
+Vector<3> Cartesian_Traj_Sequence::getAngularVelocity(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getAngularVelocity(secs);
+}
+
+/*
+    Get Twist Velocity at time secs [ v , w ]^T
+*/
+Vector<6> Cartesian_Traj_Sequence::getTwist(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getTwist(secs);
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
@@ -0,0 +1,379 @@
+/*
+
+    Double S Traj
+    Scalar trajectory with jerk limited (double S) velocity profile
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Double_S_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+
+using namespace std;
+
+namespace sun
+{
+/*=======CONSTRUCTORS======*/
+
+/*
+    return true if the limits are valid (positive and finite) and the positions are finite
+*/
+bool Double_S_Traj::checkDoubleS(double initial_position, double final_position, double max_velocity,
+                                 double max_acceleration, double max_jerk)
+{
+  return isfinite(initial_position) && isfinite(final_position) && isfinite(max_velocity) &&
+         isfinite(max_acceleration) && isfinite(max_jerk) && max_velocity > 0.0 && max_acceleration > 0.0 &&
+         max_jerk > 0.0;
+}
+
+/*
+    Compute the times from the limits and the displacement (limits are positive)
+    Rest-to-rest case of the double S profile (symmetric acceleration and deceleration):
+    1) assume max_velocity is reached, 2) if there is no cruise phase reduce the cruise speed
+*/
+void Double_S_Traj::computeTimes(double displacement, double max_velocity, double max_acceleration,
+                                 double max_jerk, double &tj, double &ta, double &tv)
+{
+  const double h = fabs(displacement);
+
+  if (max_velocity * max_jerk >= max_acceleration * max_acceleration)
+  {
+    // max_acceleration is reached
+    tj = max_acceleration / max_jerk;
+    ta = tj + max_velocity / max_acceleration;
+  }
+  else
+  {
+    // max_acceleration is not reached
+    tj = sqrt(max_velocity / max_jerk);
+    ta = 2.0 * tj;
+  }
+
+  // displacement = cruise_speed * (ta + tv)
+  tv = h / max_velocity - ta;
+  if (tv >= 0.0)
+  {
+    return;
+  }
+
+  // max_velocity is not reached
+  tv = 0.0;
+  if (h >= 2.0 * pow(max_acceleration, 3) / (max_jerk * max_jerk))
+  {
+    // max_acceleration is reached
+    tj = max_acceleration / max_jerk;
+    ta = 0.5 * tj + sqrt(0.25 * tj * tj + h / max_acceleration);
+  }
+  else
+  {
+    // max_acceleration is not reached: displacement = 2 * max_jerk * tj^3
+    tj = cbrt(h / (2.0 * max_jerk));
+    ta = 2.0 * tj;
+  }
+}
+
+/*
+    Fill the segment table from _pi, _j, _tj, _ta, _tv
+    The segments are integrated forward from the rest state in _pi
+*/
+void Double_S_Traj::updateSegments()
+{
+  const double t_const_acc = fmax(_ta - 2.0 * _tj, 0.0);
+  const double durations[7] = { _tj, t_const_acc, _tj, _tv, _tj, t_const_acc, _tj };
+  const double jerks[7] = { _j, 0.0, -_j, 0.0, -_j, 0.0, _j };
+
+  double p = _pi, v = 0.0, a = 0.0;
+  _seg_time[0] = 0.0;
+  for (int k = 0; k < 7; k++)
+  {
+    const double dt = durations[k];
+    const double j = jerks[k];
+    _seg_coeff[k][0] = p;
+    _seg_coeff[k][1] = v;
+    _seg_coeff[k][2] = 0.5 * a;
+    _seg_coeff[k][3] = j / 6.0;
+    _seg_time[k + 1] = _seg_time[k] + dt;
+
+    p += dt * (v + dt * (0.5 * a + dt * (j / 6.0)));
+    v += dt * (a + dt * (0.5 * j));
+    a += dt * j;
+  }
+}
+
+/*
+    Constructor
+*/
+Double_S_Traj::Double_S_Traj(double initial_position, double final_position, double max_velocity,
+                             double max_acceleration, double max_jerk, double initial_time)
+  : Scalar_Traj_Interface(0.0, initial_time), _pi(initial_position), _pf(final_position)
+{
+  if (!checkDoubleS(initial_position, final_position, max_velocity, max_acceleration, max_jerk))
+  {
+    trajFatal("ERROR in Double_S_Traj() | pi=%g pf=%g: non valid limits max_velocity=%g max_acceleration=%g "
+              "max_jerk=%g (have to be > 0)",
+              initial_position, final_position, max_velocity, max_acceleration, max_jerk);
+    // the fatal handler returned, hold the initial position
+    _pf = _pi;
+    max_velocity = max_acceleration = max_jerk = 1.0;
+  }
+
+  computeTimes(_pf - _pi, max_velocity, max_acceleration, max_jerk, _tj, _ta, _tv);
+  _j = (_pf >= _pi) ? max_jerk : -max_jerk;
+  updateSegments();
+  _final_time = _initial_time + _seg_time[7];
+}
+
+/*
+    Non-fatal factory, validate the inputs and return the traj or an error status
+*/
+Traj_Result<Double_S_Traj> Double_S_Traj::create(double initial_position, double final_position,
+                                                 double max_velocity, double max_acceleration, double max_jerk,
+                                                 double initial_time)
+{
+  if (!checkDoubleS(initial_position, final_position, max_velocity, max_acceleration, max_jerk))
+  {
+    return TRAJ_INVALID_ARGUMENT;
+  }
+  return Double_S_Traj(initial_position, final_position, max_velocity, max_acceleration, max_jerk, initial_time);
+}
+
+/*
+    Clone the object in the heap
+*/
+Double_S_Traj *Double_S_Traj::clone() const
+{
+  return new Double_S_Traj(*this);
+}
+
+/*
+    Clone the object in the arena
+*/
+Double_S_Traj *Double_S_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Double_S_Traj>(*this);
+}
+
+/*=======END CONSTRUCTORS======*/
+
+/*======= GETTERS =========*/
+
+double Double_S_Traj::getInitialPosition() const
+{
+  return _pi;
+}
+
+double Double_S_Traj::getFinalPosition() const
+{
+  return _pf;
+}
+
+/*
+    Get the duration of the constant jerk phases
+*/
+double Double_S_Traj::getJerkTime() const
+{
+  return _tj;
+}
+
+/*
+    Get the duration of the acceleration (and deceleration) phase
+*/
+double Double_S_Traj::getAccelerationTime() const
+{
+  return _ta;
+}
+
+/*
+    Get the duration of the constant velocity phase
+*/
+double Double_S_Traj::getCruiseDuration() const
+{
+  return _tv;
+}
+
+/*
+    Get the velocity of the constant velocity phase
+*/
+double Double_S_Traj::getCruiseSpeed() const
+{
+  return _j * _tj * (_ta - _tj);
+}
+
+/*======= END GETTERS =========*/
+
+/*
+    Get Position at time secs
+*/
+double Double_S_Traj::getPosition(double secs) const
+{
+  double t = secs - _initial_time;
+  if (t < 0.0)
+  {
+    return _pi;
+  }
+  if (t >= _seg_time[7])
+  {
+    return _pf;
+  }
+  const int k = segment(t);
+  const double *c = _seg_coeff[k];
+  t -= _seg_time[k];
+  return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+}
+
+/*
+    Get Velocity at time secs
+*/
+double Double_S_Traj::getVelocity(double secs) const
+{
+  double t = secs - _initial_time;
+  if (t < 0.0 || t >= _seg_time[7])
+  {
+    return 0.0;
+  }
+  const int k = segment(t);
+  const double *c = _seg_coeff[k];
+  t -= _seg_time[k];
+  return c[1] + t * (2.0 * c[2] + t * (3.0 * c[3]));
+}
+
+/*
+    Get Acceleration at time secs
+*/
+double Double_S_Traj::getAcceleration(double secs) const
+{
+  double t = secs - _initial_time;
+  if (t < 0.0 || t >= _seg_time[7])
+  {
+    return 0.0;
+  }
+  const int k = segment(t);
+  const double *c = _seg_coeff[k];
+  t -= _seg_time[k];
+  return 2.0 * c[2] + t * (6.0 * c[3]);
+}
+
+/*
+    Get Jerk at time secs
+*/
+double Double_S_Traj::getJerk(double secs) const
+{
+  double t = secs - _initial_time;
+  if (t < 0.0 || t >= _seg_time[7])
+  {
+    return 0.0;
+  }
+  return 6.0 * _seg_coeff[segment(t)][3];
+}
+
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+Scalar_Traj_State Double_S_Traj::getState(double secs) const
+{
+  Scalar_Traj_State state;
+  state.velocity = 0.0;
+  state.acceleration = 0.0;
+
+  double t = secs - _initial_time;
+  if (t < 0.0)
+  {
+    state.position = _pi;
+    return state;
+  }
+  if (t >= _seg_time[7])
+  {
+    state.position = _pf;
+    return state;
+  }
+  const int k = segment(t);
+  const double *c = _seg_coeff[k];
+  t -= _seg_time[k];
+  state.position = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+  state.velocity = c[1] + t * (2.0 * c[2] + t * (3.0 * c[3]));
+  state.acceleration = 2.0 * c[2] + t * (6.0 * c[3]);
+  return state;
+}
+
+/*
+    Get Position at the n time instants secs[0..n-1]
+*/
+void Double_S_Traj::getPositionBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, duration = _seg_time[7];
+  for (int i = 0; i < n; i++)
+  {
+    double t = secs[i] - ti;
+    if (t < 0.0)
+      out[i] = _pi;
+    else if (t >= duration)
+      out[i] = _pf;
+    else
+    {
+      const int k = segment(t);
+      const double *c = _seg_coeff[k];
+      t -= _seg_time[k];
+      out[i] = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+  }
+}
+
+/*
+    Get Velocity at the n time instants secs[0..n-1]
+*/
+void Double_S_Traj::getVelocityBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, duration = _seg_time[7];
+  for (int i = 0; i < n; i++)
+  {
+    double t = secs[i] - ti;
+    if (t < 0.0 || t >= duration)
+      out[i] = 0.0;
+    else
+    {
+      const int k = segment(t);
+      const double *c = _seg_coeff[k];
+      t -= _seg_time[k];
+      out[i] = c[1] + t * (2.0 * c[2] + t * (3.0 * c[3]));
+    }
+  }
+}
+
+/*
+    Get Acceleration at the n time instants secs[0..n-1]
+*/
+void Double_S_Traj::getAccelerationBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, duration = _seg_time[7];
+  for (int i = 0; i < n; i++)
+  {
+    double t = secs[i] - ti;
+    if (t < 0.0 || t >= duration)
+      out[i] = 0.0;
+    else
+    {
+      const int k = segment(t);
+      const double *c = _seg_coeff[k];
+      t -= _seg_time[k];
+      out[i] = 2.0 * c[2] + t * (6.0 * c[3]);
+    }
+  }
+}
+
+}  // namespace sun
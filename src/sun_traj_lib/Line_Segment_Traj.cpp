@@ -23,6 +23,8 @@
 */
 
 #include "sun_traj_lib/Line_Segment_Traj.h"
+#include "sun_traj_lib/Line_Segment_Traj_Cursor.h"
+#include "sun_traj_lib/Traj_Arena.h"
 
 using namespace TooN;
 using namespace std;
@@ -35,7 +37,7 @@ namespace sun
     Full Constructor
 */
 Line_Segment_Traj::Line_Segment_Traj(const Vector<3> &pi, const Vector<3> &pf, const Scalar_Traj_Interface &traj_s)
-  : Position_Traj_Interface(NAN, NAN), _pi(pi), _pf(pf), _traj_s(traj_s.clone())
+  : Position_Traj_Interface(NAN, NAN), _pi(pi), _pf(pf), _traj_s(traj_s)
 {
 }
 
@@ -43,7 +45,15 @@ Line_Segment_Traj::Line_Segment_Traj(const Vector<3> &pi, const Vector<3> &pf, c
     Copy Constructor
 */
 Line_Segment_Traj::Line_Segment_Traj(const Line_Segment_Traj &traj)
-  : Position_Traj_Interface(traj), _pi(traj._pi), _pf(traj._pf), _traj_s(traj._traj_s->clone())
+  : Position_Traj_Interface(traj), _pi(traj._pi), _pf(traj._pf), _traj_s(traj._traj_s)
+{
+}
+
+/*
+    Copy Constructor, a non built-in scalar traj is cloned in arena
+*/
+Line_Segment_Traj::Line_Segment_Traj(const Line_Segment_Traj &traj, Traj_Arena &arena)
+  : Position_Traj_Interface(traj), _pi(traj._pi), _pf(traj._pf), _traj_s(traj._traj_s, arena)
 {
 }
 
@@ -55,6 +65,22 @@ Line_Segment_Traj *Line_Segment_Traj::clone() const
   return new Line_Segment_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+Line_Segment_Traj *Line_Segment_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Line_Segment_Traj>(*this, arena);
+}
+
+/*
+    Create in the heap a cursor placed at time secs
+*/
+Position_Traj_Cursor *Line_Segment_Traj::createCursor(double secs) const
+{
+  return new Line_Segment_Traj_Cursor(_pi, _pf, _traj_s.get(), secs);
+}
+
 /*======END CONSTRUCTORS========*/
 
 /*====== GETTERS ========*/
@@ -97,7 +123,7 @@ Vector<3> Line_Segment_Traj::getFinalPoint() const
 */
 double Line_Segment_Traj::getFinalTime() const
 {
-  return _traj_s->getFinalTime();
+  return _traj_s.getFinalTime();
 }
 
 /*
@@ -105,7 +131,7 @@ double Line_Segment_Traj::getFinalTime() const
 */
 double Line_Segment_Traj::getInitialTime() const
 {
-  return _traj_s->getInitialTime();
+  return _traj_s.getInitialTime();
 }
 
 /*====== END GETTERS ========*/
@@ -124,7 +150,15 @@ double Line_Segment_Traj::getInitialTime() const
 */
 void Line_Segment_Traj::setScalarTraj(const Scalar_Traj_Interface &s_traj)
 {
-  _traj_s = Scalar_Traj_Interface_Ptr(s_traj.clone());
+  _traj_s = s_traj;
+}
+
+/*
+    Set the scalar trajectory taking ownership of s_traj
+*/
+void Line_Segment_Traj::setScalarTraj(Scalar_Traj_Interface_Ptr &&s_traj)
+{
+  _traj_s = std::move(s_traj);
 }
 
 /*
@@ -148,7 +182,7 @@ void Line_Segment_Traj::setFinalPoint(Vector<3> pf)
 */
 void Line_Segment_Traj::changeInitialTime(double initial_time)
 {
-  _traj_s->changeInitialTime(initial_time);
+  _traj_s.changeInitialTime(initial_time);
 }
 
 /*====== END SETTERS =========*/
@@ -182,7 +216,7 @@ void Line_Segment_Traj::changeFrame(const Matrix<4, 4> &new_T_curr)
 */
 Vector<3> Line_Segment_Traj::getPosition(double secs) const
 {
-  return _pi + (_traj_s->getPosition(secs) * (_pf - _pi));
+  return _pi + (_traj_s.getPosition(secs) * (_pf - _pi));
 }
 
 /*
@@ -190,7 +224,7 @@ Vector<3> Line_Segment_Traj::getPosition(double secs) const
 */
 Vector<3> Line_Segment_Traj::getVelocity(double secs) const
 {
-  return _traj_s->getVelocity(secs) * (_pf - _pi);
+  return _traj_s.getVelocity(secs) * (_pf - _pi);
 }
 
 /*
@@ -198,7 +232,7 @@ Vector<3> Line_Segment_Traj::getVelocity(double secs) const
 */
 Vector<3> Line_Segment_Traj::getAcceleration(double secs) const
 {
-  return _traj_s->getAcceleration(secs) * (_pf - _pi);
+  return _traj_s.getAcceleration(secs) * (_pf - _pi);
 }
 
 /*====== END RUNNERS =========*/
@@ -0,0 +1,73 @@
+/*
+
+    Line Segment Traj Cursor
+    Cursor of a line segment trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Line_Segment_Traj_Cursor.h"
+
+using namespace TooN;
+
+namespace sun
+{
+/*
+    Constructor, the cursor is placed at time secs
+*/
+Line_Segment_Traj_Cursor::Line_Segment_Traj_Cursor(const Vector<3>& pi, const Vector<3>& pf,
+                                                   const Scalar_Traj_Interface& traj_s, double secs)
+  : _pi(pi), _delta(pf - pi), _s_cursor(traj_s.createCursor(secs))
+{
+  _time = secs;
+  updateState();
+}
+
+/*
+    Compute the state from the state of _s_cursor
+*/
+void Line_Segment_Traj_Cursor::updateState()
+{
+  const Scalar_Traj_State& s = _s_cursor->getState();
+  _position = _pi + s.position * _delta;
+  _velocity = s.velocity * _delta;
+  _acceleration = s.acceleration * _delta;
+}
+
+/*
+    Move the cursor to time secs
+*/
+void Line_Segment_Traj_Cursor::seek(double secs)
+{
+  _time = secs;
+  _s_cursor->seek(secs);
+  updateState();
+}
+
+/*
+    Move the cursor forward by dt
+*/
+void Line_Segment_Traj_Cursor::advance(double dt)
+{
+  _time += dt;
+  _s_cursor->advance(dt);
+  updateState();
+}
+
+}  // namespace sun
@@ -0,0 +1,260 @@
+/*
+
+    OTG Traj
+    Scalar trajectory for online trajectory generation from an arbitrary initial state
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/OTG_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+
+using namespace std;
+
+namespace sun
+{
+/*=======CONSTRUCTORS======*/
+
+/*
+    return true if the limits are valid (positive and finite) and the state is finite
+*/
+bool OTG_Traj::checkOTG(double initial_position, double initial_velocity, double final_position,
+                        double max_velocity, double max_acceleration)
+{
+  return isfinite(initial_position) && isfinite(initial_velocity) && isfinite(final_position) &&
+         isfinite(max_velocity) && isfinite(max_acceleration) && max_velocity > 0.0 && max_acceleration > 0.0;
+}
+
+/*
+    Compute the phases from the displacement h, the initial velocity v0 and the limits
+    d = v0|v0|/(2a) is the (signed) stopping distance: if h >= d the cruise is forward (s = 1), else backward (s = -1)
+    In the frame of s (h' = s*h, v0' = s*v0) the profile is: v0' -> vc' >= 0 -> cruise -> 0
+    with the peak velocity vc' = sqrt(a*h' + v0'^2/2) (no cruise) limited to max_velocity
+*/
+void OTG_Traj::computePhases(double displacement, double initial_velocity, double max_velocity,
+                             double max_acceleration, double acc[3], double duration[3])
+{
+  const double a = max_acceleration;
+  const double stop_distance = initial_velocity * fabs(initial_velocity) / (2.0 * a);
+  const double s = (displacement >= stop_distance) ? 1.0 : -1.0;
+  const double h = s * displacement;
+  const double v0 = s * initial_velocity;
+
+  // h >= v0|v0|/(2a) >= -v0^2/(2a), the max is for rounding only
+  double vc = sqrt(fmax(a * h + 0.5 * v0 * v0, 0.0));
+  double t_cruise = 0.0;
+  if (vc > max_velocity)
+  {
+    vc = max_velocity;
+    // distance of v0 -> vc and of vc -> 0 at max acceleration: |vb - va| (va + vb) / (2a)
+    const double h_acc = fabs(vc - v0) * (v0 + vc) / (2.0 * a) + vc * vc / (2.0 * a);
+    t_cruise = fmax((h - h_acc) / vc, 0.0);
+  }
+
+  acc[0] = (vc >= v0) ? s * a : -s * a;
+  duration[0] = fabs(vc - v0) / a;
+  acc[1] = 0.0;
+  duration[1] = t_cruise;
+  acc[2] = -s * a;
+  duration[2] = vc / a;
+}
+
+/*
+    Fill the phase table from _pi, _vi and the phases
+    The phases are integrated forward from the initial state
+*/
+void OTG_Traj::updateSegments(const double acc[3], const double duration[3])
+{
+  double p = _pi, v = _vi;
+  _seg_time[0] = 0.0;
+  for (int k = 0; k < 3; k++)
+  {
+    const double dt = duration[k];
+    _seg_coeff[k][0] = p;
+    _seg_coeff[k][1] = v;
+    _seg_coeff[k][2] = 0.5 * acc[k];
+    _seg_time[k + 1] = _seg_time[k] + dt;
+
+    p += dt * (v + dt * (0.5 * acc[k]));
+    v += dt * acc[k];
+  }
+}
+
+/*
+    Constructor
+*/
+OTG_Traj::OTG_Traj(double initial_position, double initial_velocity, double final_position, double max_velocity,
+                   double max_acceleration, double initial_time)
+  : Scalar_Traj_Interface(0.0, initial_time), _pi(initial_position), _vi(initial_velocity), _pf(final_position)
+{
+  if (!checkOTG(initial_position, initial_velocity, final_position, max_velocity, max_acceleration))
+  {
+    trajFatal("ERROR in OTG_Traj() | pi=%g vi=%g pf=%g: non valid inputs max_velocity=%g max_acceleration=%g "
+              "(limits have to be > 0)",
+              initial_position, initial_velocity, final_position, max_velocity, max_acceleration);
+    // the fatal handler returned, hold the initial position
+    _vi = 0.0;
+    _pf = _pi;
+    max_velocity = max_acceleration = 1.0;
+  }
+
+  double acc[3], duration[3];
+  computePhases(_pf - _pi, _vi, max_velocity, max_acceleration, acc, duration);
+  updateSegments(acc, duration);
+  _final_time = _initial_time + _seg_time[3];
+}
+
+/*
+    Non-fatal factory, validate the inputs and return the traj or an error status
+*/
+Traj_Result<OTG_Traj> OTG_Traj::create(double initial_position, double initial_velocity, double final_position,
+                                       double max_velocity, double max_acceleration, double initial_time)
+{
+  if (!checkOTG(initial_position, initial_velocity, final_position, max_velocity, max_acceleration))
+  {
+    return TRAJ_INVALID_ARGUMENT;
+  }
+  return OTG_Traj(initial_position, initial_velocity, final_position, max_velocity, max_acceleration, initial_time);
+}
+
+/*
+    Clone the object in the heap
+*/
+OTG_Traj *OTG_Traj::clone() const
+{
+  return new OTG_Traj(*this);
+}
+
+/*
+    Clone the object in the arena
+*/
+OTG_Traj *OTG_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<OTG_Traj>(*this);
+}
+
+/*=======END CONSTRUCTORS======*/
+
+/*======= GETTERS =========*/
+
+double OTG_Traj::getInitialPosition() const
+{
+  return _pi;
+}
+
+double OTG_Traj::getInitialVelocity() const
+{
+  return _vi;
+}
+
+double OTG_Traj::getFinalPosition() const
+{
+  return _pf;
+}
+
+/*
+    Get the velocity of the cruise phase (signed)
+*/
+double OTG_Traj::getCruiseSpeed() const
+{
+  return _seg_coeff[1][1];
+}
+
+/*======= END GETTERS =========*/
+
+/*
+    Get Position at time secs
+*/
+double OTG_Traj::getPosition(double secs) const
+{
+  double t = secs - _initial_time;
+  if (t < 0.0)
+  {
+    return _pi;
+  }
+  if (t >= _seg_time[3])
+  {
+    return _pf;
+  }
+  const int k = segment(t);
+  const double *c = _seg_coeff[k];
+  t -= _seg_time[k];
+  return c[0] + t * (c[1] + t * c[2]);
+}
+
+/*
+    Get Velocity at time secs
+    Before the initial time the traj holds the initial position (zero velocity)
+*/
+double OTG_Traj::getVelocity(double secs) const
+{
+  double t = secs - _initial_time;
+  if (t < 0.0 || t >= _seg_time[3])
+  {
+    return 0.0;
+  }
+  const int k = segment(t);
+  const double *c = _seg_coeff[k];
+  t -= _seg_time[k];
+  return c[1] + t * (2.0 * c[2]);
+}
+
+/*
+    Get Acceleration at time secs
+*/
+double OTG_Traj::getAcceleration(double secs) const
+{
+  double t = secs - _initial_time;
+  if (t < 0.0 || t >= _seg_time[3])
+  {
+    return 0.0;
+  }
+  return 2.0 * _seg_coeff[segment(t)][2];
+}
+
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+Scalar_Traj_State OTG_Traj::getState(double secs) const
+{
+  Scalar_Traj_State state;
+  state.velocity = 0.0;
+  state.acceleration = 0.0;
+
+  double t = secs - _initial_time;
+  if (t < 0.0)
+  {
+    state.position = _pi;
+    return state;
+  }
+  if (t >= _seg_time[3])
+  {
+    state.position = _pf;
+    return state;
+  }
+  const int k = segment(t);
+  const double *c = _seg_coeff[k];
+  t -= _seg_time[k];
+  state.position = c[0] + t * (c[1] + t * c[2]);
+  state.velocity = c[1] + t * (2.0 * c[2]);
+  state.acceleration = 2.0 * c[2];
+  return state;
+}
+
+}  // namespace sun
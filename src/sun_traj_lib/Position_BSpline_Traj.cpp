@@ -0,0 +1,641 @@
+/*
+
+    Position BSpline Traj
+    Position trajectory along a B-spline through waypoints, parameterized by arc length
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Position_BSpline_Traj.h"
+#include <algorithm>
+
+using namespace TooN;
+using namespace std;
+
+namespace sun
+{
+/*
+    Nodes and weights of the 5 points Gauss-Legendre quadrature on [-1,1]
+*/
+static const double GAUSS_NODES[5] = { -0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831,
+                                       0.9061798459386640 };
+static const double GAUSS_WEIGHTS[5] = { 0.2369268850561891, 0.4786286704993665, 0.5688888888888889,
+                                         0.4786286704993665, 0.2369268850561891 };
+
+/*
+    Basis functions of degree p and their derivatives up to order n at u in the knot span i
+    (The NURBS Book, A2.3), ders[k*(p+1)+j] is the k-th derivative of N_(i-p+j)
+*/
+static void basisDerivatives(const vector<double> &U, int i, double u, int p, int n, vector<double> &ders)
+{
+  vector<vector<double> > ndu(p + 1, vector<double>(p + 1)), a(2, vector<double>(p + 1));
+  vector<double> left(p + 1), right(p + 1);
+  ndu[0][0] = 1.0;
+  for (int j = 1; j <= p; j++)
+  {
+    left[j] = u - U[i + 1 - j];
+    right[j] = U[i + j] - u;
+    double saved = 0.0;
+    for (int r = 0; r < j; r++)
+    {
+      ndu[j][r] = right[r + 1] + left[j - r];
+      const double temp = ndu[r][j - 1] / ndu[j][r];
+      ndu[r][j] = saved + right[r + 1] * temp;
+      saved = left[j - r] * temp;
+    }
+    ndu[j][j] = saved;
+  }
+
+  ders.assign((n + 1) * (p + 1), 0.0);
+  for (int j = 0; j <= p; j++)
+  {
+    ders[j] = ndu[j][p];
+  }
+  for (int r = 0; r <= p; r++)
+  {
+    int s1 = 0, s2 = 1;
+    a[0][0] = 1.0;
+    for (int k = 1; k <= n; k++)
+    {
+      double d = 0.0;
+      const int rk = r - k, pk = p - k;
+      if (r >= k)
+      {
+        a[s2][0] = a[s1][0] / ndu[pk + 1][rk];
+        d = a[s2][0] * ndu[rk][pk];
+      }
+      const int j1 = (rk >= -1) ? 1 : -rk;
+      const int j2 = (r - 1 <= pk) ? k - 1 : p - r;
+      for (int j = j1; j <= j2; j++)
+      {
+        a[s2][j] = (a[s1][j] - a[s1][j - 1]) / ndu[pk + 1][rk + j];
+        d += a[s2][j] * ndu[rk + j][pk];
+      }
+      if (r <= pk)
+      {
+        a[s2][k] = -a[s1][k - 1] / ndu[pk + 1][r];
+        d += a[s2][k] * ndu[r][pk];
+      }
+      ders[k * (p + 1) + r] = d;
+      std::swap(s1, s2);
+    }
+  }
+  double factor = p;
+  for (int k = 1; k <= n; k++)
+  {
+    for (int j = 0; j <= p; j++)
+    {
+      ders[k * (p + 1) + j] *= factor;
+    }
+    factor *= (p - k);
+  }
+}
+
+/*======CONSTRUCTORS========*/
+
+/*
+    Full Constructor
+*/
+Position_BSpline_Traj::Position_BSpline_Traj(const vector<Vector<3> > &waypoints, const Scalar_Traj_Interface &traj_s,
+                                             int degree)
+  : Position_Traj_Interface(NAN, NAN), _degree(degree), _length(0.0), _traj_s(traj_s)
+{
+  _duration = NAN;
+  _initial_time = NAN;
+
+  // merge the consecutive coincident waypoints (zero chord length)
+  _waypoints.reserve(waypoints.size());
+  for (const auto &point : waypoints)
+  {
+    if (_waypoints.empty() || norm(point - _waypoints.back()) > 0.0)
+    {
+      _waypoints.push_back(point);
+    }
+  }
+
+  if (_degree < 1)
+  {
+    trajFatal("Error in Position_BSpline_Traj() | non valid degree %d (it has to be >= 1)", degree);
+    // fallback: cubic
+    _degree = 3;
+  }
+
+  if (_waypoints.size() < 2)
+  {
+    trajFatal("Error in Position_BSpline_Traj() | at least 2 distinct waypoints are needed (%d given)",
+              int(_waypoints.size()));
+    // fallback: hold the first waypoint
+    if (_waypoints.empty())
+      _waypoints.push_back(Vector<3>(Zeros));
+    _control_points = _waypoints;
+    return;
+  }
+
+  updateSpline();
+}
+
+/*
+    Clone the object in the heap
+*/
+Position_BSpline_Traj *Position_BSpline_Traj::clone() const
+{
+  return new Position_BSpline_Traj(*this);
+}
+
+/*
+    Compute the control points, the span coefficients and the arc length table from _waypoints
+    Global interpolation (The NURBS Book, 9.2.1): chord length parameters, knots by averaging,
+    the collocation matrix is banded (bandwidth < degree) and totally positive: no pivoting is needed
+*/
+void Position_BSpline_Traj::updateSpline()
+{
+  const int n = _waypoints.size();
+  _degree = std::min(_degree, n - 1);
+  const int p = _degree;
+
+  // chord length parameters
+  vector<double> params(n);
+  params[0] = 0.0;
+  for (int k = 1; k < n; k++)
+  {
+    params[k] = params[k - 1] + norm(_waypoints[k] - _waypoints[k - 1]);
+  }
+  const double chord = params[n - 1];
+  for (int k = 1; k < n - 1; k++)
+  {
+    params[k] /= chord;
+  }
+  params[n - 1] = 1.0;
+
+  // knots by averaging
+  vector<double> knots(n + p + 1);
+  for (int j = 0; j <= p; j++)
+  {
+    knots[j] = 0.0;
+    knots[n + j] = 1.0;
+  }
+  for (int j = 1; j < n - p; j++)
+  {
+    double sum = 0.0;
+    for (int i = j; i < j + p; i++)
+    {
+      sum += params[i];
+    }
+    knots[j + p] = sum / p;
+  }
+
+  // collocation matrix in band storage, A(i,j) = band[i*(2p+1) + j-i+p]
+  const int width = 2 * p + 1;
+  vector<double> band(n * width, 0.0), ders;
+  for (int k = 0; k < n; k++)
+  {
+    const int span = std::upper_bound(knots.begin() + p + 1, knots.begin() + n, params[k]) - knots.begin() - 1;
+    basisDerivatives(knots, span, params[k], p, 0, ders);
+    for (int j = 0; j <= p; j++)
+    {
+      const int col = span - p + j;
+      if (col - k >= -p && col - k <= p)
+      {
+        band[k * width + col - k + p] = ders[j];
+      }
+    }
+  }
+
+  // banded gaussian elimination
+  _control_points = _waypoints;
+  for (int k = 0; k < n; k++)
+  {
+    const int last = std::min(k + p, n - 1);
+    for (int i = k + 1; i <= last; i++)
+    {
+      const double factor = band[i * width + k - i + p] / band[k * width + p];
+      if (factor == 0.0)
+        continue;
+      for (int j = k; j <= last; j++)
+      {
+        band[i * width + j - i + p] -= factor * band[k * width + j - k + p];
+      }
+      _control_points[i] -= factor * _control_points[k];
+    }
+  }
+  for (int k = n - 1; k >= 0; k--)
+  {
+    Vector<3> x = _control_points[k];
+    for (int j = k + 1; j <= std::min(k + p, n - 1); j++)
+    {
+      x -= band[k * width + j - k + p] * _control_points[j];
+    }
+    _control_points[k] = x / band[k * width + p];
+  }
+
+  // power basis coefficients of the spans: Taylor expansion at the start of the span
+  const int num_spans = n - p;
+  _breaks.assign(knots.begin() + p, knots.begin() + n + 1);
+  _span_coeff.assign(num_spans * (p + 1), Vector<3>(Zeros));
+  for (int i = 0; i < num_spans; i++)
+  {
+    const int span = i + p;
+    basisDerivatives(knots, span, _breaks[i], p, p, ders);
+    double factorial = 1.0;
+    for (int k = 0; k <= p; k++)
+    {
+      if (k > 0)
+        factorial *= k;
+      Vector<3> c = Zeros;
+      for (int j = 0; j <= p; j++)
+      {
+        c += ders[k * (p + 1) + j] * _control_points[span - p + j];
+      }
+      _span_coeff[i * (p + 1) + k] = c / factorial;
+    }
+  }
+
+  updateArcLength();
+}
+
+/*
+    Fill the arc length table from the span coefficients
+    POSITION_BSPLINE_ARC_SAMPLES intervals per span, refined by appendArcNodes
+*/
+void Position_BSpline_Traj::updateArcLength()
+{
+  const int num_spans = _breaks.size() - 1;
+  _arc_u.clear();
+  _arc_length.clear();
+  _arc_du.clear();
+  _arc_span.clear();
+
+  _length = 0.0;
+  for (int i = 0; i < num_spans; i++)
+  {
+    const double h = (_breaks[i + 1] - _breaks[i]) / POSITION_BSPLINE_ARC_SAMPLES;
+    for (int m = 0; m < POSITION_BSPLINE_ARC_SAMPLES; m++)
+    {
+      const double u0 = _breaks[i] + m * h;
+      const double u1 = (m == POSITION_BSPLINE_ARC_SAMPLES - 1) ? _breaks[i + 1] : u0 + h;
+      appendArcNodes(i, u0, u1, spanLength(i, u0, u1), 0);
+    }
+  }
+  appendArcNode(num_spans - 1, 1.0);
+}
+
+/*
+    Append the node at u of the span to the arc length table, the arc length of the node is _length
+*/
+void Position_BSpline_Traj::appendArcNode(int span, double u)
+{
+  Vector<3> d1;
+  evalSpan(span, u, nullptr, &d1, nullptr);
+  const double speed = norm(d1);
+  _arc_u.push_back(u);
+  _arc_length.push_back(_length);
+  _arc_du.push_back((speed > 0.0) ? 1.0 / speed : 0.0);
+  _arc_span.push_back(span);
+}
+
+/*
+    Append the nodes of the interval [u0, u1) of the span to the arc length table
+    interval_length is the quadrature of the interval, the interval is bisected while it differs from the sum of
+    the quadratures of the halves by more than POSITION_BSPLINE_ARC_TOL (relative), at most
+    POSITION_BSPLINE_ARC_MAX_DEPTH times (the integrand |C'| is not smooth where C' is close to zero)
+*/
+void Position_BSpline_Traj::appendArcNodes(int span, double u0, double u1, double interval_length, int depth)
+{
+  const double um = 0.5 * (u0 + u1);
+  const double left = spanLength(span, u0, um), right = spanLength(span, um, u1);
+  if (depth < POSITION_BSPLINE_ARC_MAX_DEPTH &&
+      std::fabs(left + right - interval_length) > POSITION_BSPLINE_ARC_TOL * (left + right))
+  {
+    appendArcNodes(span, u0, um, left, depth + 1);
+    appendArcNodes(span, um, u1, right, depth + 1);
+    return;
+  }
+  appendArcNode(span, u0);
+  // the same quadrature of the Newton steps of lengthToParam: u(l) is continuous at the nodes
+  _length += interval_length;
+}
+
+/*======END CONSTRUCTORS========*/
+
+/*====== GETTERS ========*/
+
+int Position_BSpline_Traj::getDegree() const
+{
+  return _degree;
+}
+
+/*
+    Get length of the curve
+*/
+double Position_BSpline_Traj::getLength() const
+{
+  return _length;
+}
+
+int Position_BSpline_Traj::getNumWaypoints() const
+{
+  return _waypoints.size();
+}
+
+Vector<3> Position_BSpline_Traj::getWaypoint(int i) const
+{
+  return _waypoints[i];
+}
+
+int Position_BSpline_Traj::getNumControlPoints() const
+{
+  return _control_points.size();
+}
+
+Vector<3> Position_BSpline_Traj::getControlPoint(int i) const
+{
+  return _control_points[i];
+}
+
+/*
+    Get the final time instant
+*/
+double Position_BSpline_Traj::getFinalTime() const
+{
+  return _traj_s.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Position_BSpline_Traj::getInitialTime() const
+{
+  return _traj_s.getInitialTime();
+}
+
+/*====== END GETTERS ========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Set the scalar trajectory
+    Trajectory for the scalar s variable should be a traj from 0 to 1 (normalized arc length)
+*/
+void Position_BSpline_Traj::setScalarTraj(const Scalar_Traj_Interface &s_traj)
+{
+  _traj_s = s_traj;
+}
+
+/*
+    Set the scalar trajectory taking ownership of s_traj
+*/
+void Position_BSpline_Traj::setScalarTraj(Scalar_Traj_Interface_Ptr &&s_traj)
+{
+  _traj_s = std::move(s_traj);
+}
+
+/*
+    Change the initial time instant (translate the trajectory in the time)
+*/
+void Position_BSpline_Traj::changeInitialTime(double initial_time)
+{
+  _traj_s.changeInitialTime(initial_time);
+}
+
+/*====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of the trajectory
+    Apply an homogeneous transfrmation matrix to the trajectory
+    new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+    The points and the constant coefficients are roto-translated, the other coefficients are rotated
+    (the arc length table is not changed by a rigid transformation)
+*/
+void Position_BSpline_Traj::changeFrame(const Matrix<4, 4> &new_T_curr)
+{
+  Matrix<3, 3> R = new_T_curr.slice<0, 0, 3, 3>();
+  Vector<3> t = makeVector(new_T_curr(0, 3), new_T_curr(1, 3), new_T_curr(2, 3));
+  for (auto &point : _waypoints)
+  {
+    point = R * point + t;
+  }
+  for (auto &point : _control_points)
+  {
+    point = R * point + t;
+  }
+  for (size_t i = 0; i < _span_coeff.size(); i++)
+  {
+    _span_coeff[i] = R * _span_coeff[i];
+    if (i % (_degree + 1) == 0)
+      _span_coeff[i] += t;
+  }
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Arc length of the span from u0 to u (5 points Gauss-Legendre quadrature)
+*/
+double Position_BSpline_Traj::spanLength(int span, double u0, double u) const
+{
+  const double h = u - u0;
+  Vector<3> d1;
+  double length = 0.0;
+  for (int g = 0; g < 5; g++)
+  {
+    evalSpan(span, u0 + 0.5 * h * (GAUSS_NODES[g] + 1.0), nullptr, &d1, nullptr);
+    length += GAUSS_WEIGHTS[g] * norm(d1);
+  }
+  return 0.5 * h * length;
+}
+
+/*
+    Parameter u of the arc length l
+    The table interval is found by binary search, the initial guess is the cubic Hermite interpolation of the nodes
+    (values u and slopes du/dl), then POSITION_BSPLINE_NEWTON_STEPS Newton steps on the arc length from the node
+    (spanLength) are done, a step outside the table interval is replaced by a bisection
+*/
+double Position_BSpline_Traj::lengthToParam(double l, int &span) const
+{
+  l = std::max(0.0, std::min(l, _length));
+  const int j =
+      std::upper_bound(_arc_length.begin() + 1, _arc_length.end() - 1, l) - (_arc_length.begin() + 1);
+  span = _arc_span[j];
+
+  const double h = _arc_length[j + 1] - _arc_length[j];
+  if (!(h > 0.0))
+  {
+    return _arc_u[j];
+  }
+  const double dl = l - _arc_length[j];
+  const double tau = dl / h;
+  const double tau2 = tau * tau, tau3 = tau2 * tau;
+  double u = (2.0 * tau3 - 3.0 * tau2 + 1.0) * _arc_u[j] + (tau3 - 2.0 * tau2 + tau) * h * _arc_du[j] +
+             (-2.0 * tau3 + 3.0 * tau2) * _arc_u[j + 1] + (tau3 - tau2) * h * _arc_du[j + 1];
+
+  // Newton refinement, the root is bracketed by [u_low, u_high]
+  double u_low = _arc_u[j], u_high = _arc_u[j + 1];
+  if (!(u >= u_low && u <= u_high))
+  {
+    u = 0.5 * (u_low + u_high);
+  }
+  Vector<3> d1;
+  for (int k = 0; k < POSITION_BSPLINE_NEWTON_STEPS; k++)
+  {
+    const double err = spanLength(span, _arc_u[j], u) - dl;
+    if (err > 0.0)
+      u_high = u;
+    else
+      u_low = u;
+    evalSpan(span, u, nullptr, &d1, nullptr);
+    const double speed = norm(d1);
+    const double u_next = (speed > 0.0) ? u - err / speed : NAN;
+    u = (u_next >= u_low && u_next <= u_high) ? u_next : 0.5 * (u_low + u_high);
+  }
+  return u;
+}
+
+/*
+    Point, first and second derivative w.r.t. u of the span at u (Horner)
+*/
+void Position_BSpline_Traj::evalSpan(int span, double u, Vector<3> *point, Vector<3> *d1, Vector<3> *d2) const
+{
+  const int p = _degree;
+  const Vector<3> *c = &_span_coeff[span * (p + 1)];
+  const double t = u - _breaks[span];
+  if (point)
+  {
+    Vector<3> x = c[p];
+    for (int k = p - 1; k >= 0; k--)
+    {
+      x = x * t + c[k];
+    }
+    *point = x;
+  }
+  if (d1)
+  {
+    Vector<3> x = double(p) * c[p];
+    for (int k = p - 1; k >= 1; k--)
+    {
+      x = x * t + double(k) * c[k];
+    }
+    *d1 = x;
+  }
+  if (d2)
+  {
+    Vector<3> x = Zeros;
+    if (p >= 2)
+    {
+      x = double(p * (p - 1)) * c[p];
+      for (int k = p - 1; k >= 2; k--)
+      {
+        x = x * t + double(k * (k - 1)) * c[k];
+      }
+    }
+    *d2 = x;
+  }
+}
+
+/*
+    Position, velocity and acceleration at time secs
+    l = L*s, u = u(l) (lengthToParam, as getPosition) with du/dl = 1/|C'| and d2u/dl2 = -(C'.C'')/|C'|^4
+    velocity = C' du/dl dl/dt
+    acceleration = C'' (du/dl dl/dt)^2 + C' (d2u/dl2 (dl/dt)^2 + du/dl d2l/dt2)
+*/
+void Position_BSpline_Traj::evaluate(double secs, Vector<3> *position, Vector<3> *velocity,
+                                     Vector<3> *acceleration) const
+{
+  if (!(_length > 0.0))
+  {
+    // the traj is a point
+    if (position)
+      *position = _waypoints[0];
+    if (velocity)
+      *velocity = Zeros;
+    if (acceleration)
+      *acceleration = Zeros;
+    return;
+  }
+
+  const Scalar_Traj_State s = _traj_s.getState(secs);
+  int span;
+  const double u = lengthToParam(s.position * _length, span);
+  Vector<3> d1, d2;
+  evalSpan(span, u, position, &d1, acceleration ? &d2 : nullptr);
+
+  const double speed = norm(d1);
+  const double du = (speed > 0.0) ? 1.0 / speed : 0.0;
+  const double l_dot = _length * s.velocity;
+  if (velocity)
+  {
+    *velocity = (du * l_dot) * d1;
+  }
+  if (acceleration)
+  {
+    const double du2 = -(d1 * d2) * du * du * du * du;
+    *acceleration = (du * du * l_dot * l_dot) * d2 + (du2 * l_dot * l_dot + du * _length * s.acceleration) * d1;
+  }
+}
+
+/*
+    Get the point at normalized arc length s
+*/
+Vector<3> Position_BSpline_Traj::getPointAt(double s) const
+{
+  if (!(_length > 0.0))
+  {
+    return _waypoints[0];
+  }
+  int span;
+  const double u = lengthToParam(s * _length, span);
+  Vector<3> point;
+  evalSpan(span, u, &point, nullptr, nullptr);
+  return point;
+}
+
+/*
+    Get Position at time secs
+*/
+Vector<3> Position_BSpline_Traj::getPosition(double secs) const
+{
+  return getPointAt(_traj_s.getPosition(secs));
+}
+
+/*
+    Get Velocity at time secs
+*/
+Vector<3> Position_BSpline_Traj::getVelocity(double secs) const
+{
+  Vector<3> velocity;
+  evaluate(secs, nullptr, &velocity, nullptr);
+  return velocity;
+}
+
+/*
+    Get Acceleration at time secs
+*/
+Vector<3> Position_BSpline_Traj::getAcceleration(double secs) const
+{
+  Vector<3> acceleration;
+  evaluate(secs, nullptr, nullptr, &acceleration);
+  return acceleration;
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
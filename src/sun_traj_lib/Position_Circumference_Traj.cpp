@@ -23,6 +23,8 @@
 */
 
 #include "sun_traj_lib/Position_Circumference_Traj.h"
+#include "sun_traj_lib/Position_Circumference_Traj_Cursor.h"
+#include "sun_traj_lib/Traj_Arena.h"
 
 using namespace std;
 using namespace TooN;
@@ -36,7 +38,7 @@ namespace sun
 */
 Position_Circumference_Traj::Position_Circumference_Traj(const Vector<3> &r_hat, const Vector<3> &d,
                                                          const Vector<3> &pi, const Scalar_Traj_Interface &traj_s)
-  : Position_Traj_Interface(NAN, NAN), _traj_s(traj_s.clone())
+  : Position_Traj_Interface(NAN, NAN), _traj_s(traj_s)
 {
   Vector<3> _r_hat = unit(r_hat);
 
@@ -44,7 +46,7 @@ Position_Circumference_Traj::Position_Circumference_Traj(const Vector<3> &r_hat,
 
   if (fabs(delta * r_hat) >= norm(delta) || (norm(r_hat) < 10.0 * std::numeric_limits<double>::epsilon()))
   {
-    cout << TRAJ_WARN_COLOR "THE CIRCUMFERENCE TRAJ IS A POINT!" CRESET << endl;
+    trajDiagnostic(TRAJ_DIAG_WARN, "THE CIRCUMFERENCE TRAJ IS A POINT!");
     _c = pi;
     _R = Identity;
     _rho = 0.0;
@@ -92,7 +94,15 @@ void Position_Circumference_Traj::two_points_2_center(const Vector<3> &r_hat, co
     Copy Constructor
 */
 Position_Circumference_Traj::Position_Circumference_Traj(const Position_Circumference_Traj &traj)
-  : Position_Traj_Interface(traj), _c(traj._c), _rho(traj._rho), _R(traj._R), _traj_s(traj._traj_s->clone())
+  : Position_Traj_Interface(traj), _c(traj._c), _rho(traj._rho), _R(traj._R), _traj_s(traj._traj_s)
+{
+}
+
+/*
+    Copy Constructor, a non built-in scalar traj is cloned in arena
+*/
+Position_Circumference_Traj::Position_Circumference_Traj(const Position_Circumference_Traj &traj, Traj_Arena &arena)
+  : Position_Traj_Interface(traj), _c(traj._c), _rho(traj._rho), _R(traj._R), _traj_s(traj._traj_s, arena)
 {
 }
 
@@ -104,6 +114,22 @@ Position_Circumference_Traj *Position_Circumference_Traj::clone() const
   return new Position_Circumference_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+Position_Circumference_Traj *Position_Circumference_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Position_Circumference_Traj>(*this, arena);
+}
+
+/*
+    Create in the heap a cursor placed at time secs
+*/
+Position_Traj_Cursor *Position_Circumference_Traj::createCursor(double secs) const
+{
+  return new Position_Circumference_Traj_Cursor(_c, _R, _rho, _traj_s.get(), secs);
+}
+
 /*======END CONSTRUCTORS========*/
 
 /*====== GETTERS ========*/
@@ -148,7 +174,7 @@ bool Position_Circumference_Traj::isAPoint() const
 */
 double Position_Circumference_Traj::getFinalTime() const
 {
-  return _traj_s->getFinalTime();
+  return _traj_s.getFinalTime();
 }
 
 /*
@@ -156,7 +182,7 @@ double Position_Circumference_Traj::getFinalTime() const
 */
 double Position_Circumference_Traj::getInitialTime() const
 {
-  return _traj_s->getInitialTime();
+  return _traj_s.getInitialTime();
 }
 
 /*====== END GETTERS ========*/
@@ -172,7 +198,15 @@ double Position_Circumference_Traj::getInitialTime() const
 */
 void Position_Circumference_Traj::setScalarTraj(const Scalar_Traj_Interface &s_traj)
 {
-  _traj_s = Scalar_Traj_Interface_Ptr(s_traj.clone());
+  _traj_s = s_traj;
+}
+
+/*
+    Set the scalar trajectory taking ownership of s_traj
+*/
+void Position_Circumference_Traj::setScalarTraj(Scalar_Traj_Interface_Ptr &&s_traj)
+{
+  _traj_s = std::move(s_traj);
 }
 
 /*
@@ -180,7 +214,7 @@ void Position_Circumference_Traj::setScalarTraj(const Scalar_Traj_Interface &s_t
 */
 void Position_Circumference_Traj::changeInitialTime(double initial_time)
 {
-  _traj_s->changeInitialTime(initial_time);
+  _traj_s.changeInitialTime(initial_time);
 }
 
 /*====== END SETTERS =========*/
@@ -220,7 +254,7 @@ Vector<3> Position_Circumference_Traj::getPosition(double secs) const
     return _c;
   }
 
-  double s = _traj_s->getPosition(secs);
+  double s = _traj_s.getPosition(secs);
 
   return _c + _R * makeVector(_rho * cos(s), _rho * sin(s), 0.0);
 }
@@ -235,8 +269,8 @@ Vector<3> Position_Circumference_Traj::getVelocity(double secs) const
     return Zeros;
   }
 
-  double s = _traj_s->getPosition(secs);
-  double s_dot = _traj_s->getVelocity(secs);
+  double s = _traj_s.getPosition(secs);
+  double s_dot = _traj_s.getVelocity(secs);
 
   return _R * makeVector(-_rho * sin(s) * s_dot, _rho * cos(s) * s_dot, 0.0);
 }
@@ -251,12 +285,13 @@ Vector<3> Position_Circumference_Traj::getAcceleration(double secs) const
     return Zeros;
   }
 
-  double s = _traj_s->getPosition(secs);
-  double s_dot = _traj_s->getVelocity(secs);
-  double s_2dot = _traj_s->getAcceleration(secs);
+  Scalar_Traj_State s_state = _traj_s.getState(secs);
+  double cos_s = cos(s_state.position);
+  double sin_s = sin(s_state.position);
+  double s_dot_2 = pow(s_state.velocity, 2);
 
-  return _R * makeVector(-_rho * cos(s) * pow(s_dot, 2) - _rho * sin(s) * s_2dot,
-                         -_rho * sin(s) * pow(s_dot, 2) + _rho * cos(s) * s_2dot, 0.0);
+  return _R * makeVector(-_rho * cos_s * s_dot_2 - _rho * sin_s * s_state.acceleration,
+                         -_rho * sin_s * s_dot_2 + _rho * cos_s * s_state.acceleration, 0.0);
 }
 
 /*
@@ -264,7 +299,7 @@ Vector<3> Position_Circumference_Traj::getAcceleration(double secs) const
 */
 double Position_Circumference_Traj::getAngularPosition(double secs) const
 {
-  return _traj_s->getPosition(secs);
+  return _traj_s.getPosition(secs);
 }
 
 /*
@@ -272,7 +307,7 @@ double Position_Circumference_Traj::getAngularPosition(double secs) const
 */
 double Position_Circumference_Traj::getAngularVelocity(double secs) const
 {
-  return _traj_s->getVelocity(secs);
+  return _traj_s.getVelocity(secs);
 }
 
 /*
@@ -280,7 +315,7 @@ double Position_Circumference_Traj::getAngularVelocity(double secs) const
 */
 double Position_Circumference_Traj::getAngularAcceleration(double secs) const
 {
-  return _traj_s->getAcceleration(secs);
+  return _traj_s.getAcceleration(secs);
 }
 
 /*====== END RUNNERS =========*/
@@ -0,0 +1,108 @@
+/*
+
+    Position Circumference Traj Cursor
+    Cursor of a circumference trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Position_Circumference_Traj_Cursor.h"
+
+using namespace std;
+using namespace TooN;
+
+namespace sun
+{
+/*
+    Constructor, the cursor is placed at time secs
+*/
+Position_Circumference_Traj_Cursor::Position_Circumference_Traj_Cursor(const Vector<3>& c, const Matrix<3, 3>& R,
+                                                                       double rho, const Scalar_Traj_Interface& traj_s,
+                                                                       double secs)
+  : _c(c), _is_a_point(rho == 0.0), _s_cursor(traj_s.createCursor(secs)), _recurrence(false)
+{
+  _rho_x = R.T()[0];
+  _rho_x *= rho;
+  _rho_y = R.T()[1];
+  _rho_y *= rho;
+  _time = secs;
+  _sin_cos.reset(_s_cursor->getPosition());
+  updateState();
+}
+
+/*
+    Compute the state from the state of _s_cursor and _sin_cos
+*/
+void Position_Circumference_Traj_Cursor::updateState()
+{
+  if (_is_a_point)
+  {
+    _position = _c;
+    _velocity = Zeros;
+    _acceleration = Zeros;
+    return;
+  }
+
+  const Scalar_Traj_State& s = _s_cursor->getState();
+  double cos_s = _sin_cos.getCos();
+  double sin_s = _sin_cos.getSin();
+  double s_dot_2 = s.velocity * s.velocity;
+
+  // p = c + rho*R*[cos(s) sin(s) 0]^T and its derivatives
+  _position = _c + cos_s * _rho_x + sin_s * _rho_y;
+  _velocity = s.velocity * (cos_s * _rho_y - sin_s * _rho_x);
+  _acceleration = (-cos_s * s_dot_2 - sin_s * s.acceleration) * _rho_x +
+                  (-sin_s * s_dot_2 + cos_s * s.acceleration) * _rho_y;
+}
+
+/*
+    Move the cursor to time secs
+*/
+void Position_Circumference_Traj_Cursor::seek(double secs)
+{
+  _time = secs;
+  _s_cursor->seek(secs);
+  _sin_cos.reset(_s_cursor->getPosition());
+  updateState();
+}
+
+/*
+    Move the cursor forward by dt
+*/
+void Position_Circumference_Traj_Cursor::advance(double dt)
+{
+  _time += dt;
+  _s_cursor->advance(dt);
+  if (_recurrence)
+    _sin_cos.update(_s_cursor->getPosition());
+  else
+    _sin_cos.reset(_s_cursor->getPosition());
+  updateState();
+}
+
+/*
+    Enable/disable the recurrence mode of advance()
+*/
+void Position_Circumference_Traj_Cursor::setRecurrence(bool enable, int resync_period)
+{
+  _recurrence = enable;
+  _sin_cos.setResyncPeriod(resync_period);
+}
+
+}  // namespace sun
@@ -0,0 +1,352 @@
+/*
+
+    Position Traj Sequence
+    Position traj made of a sequence of position trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Position_Traj_Sequence.h"
+#include "sun_traj_lib/Line_Segment_Traj.h"
+#include "sun_traj_lib/Position_Circumference_Traj.h"
+#include "sun_traj_lib/Quintic_Poly_Traj.h"
+
+using namespace TooN;
+
+namespace sun
+{
+/* ====== CONSTRUCTORS =======*/
+
+/*
+    Void Constructor (empty sequence)
+*/
+Position_Traj_Sequence::Position_Traj_Sequence() : Position_Traj_Interface(NAN, NAN)
+{
+}
+
+/*
+    Full constructor
+*/
+Position_Traj_Sequence::Position_Traj_Sequence(const std::vector<Position_Traj_Interface_Ptr>& traj_vec)
+  : Position_Traj_Interface(NAN, NAN)
+{
+  _traj_vec.reserve(traj_vec.size());
+  for (const auto& element : traj_vec)
+  {
+    push_back_traj(*element);
+  }
+}
+
+/*
+    Copy Constructor
+*/
+Position_Traj_Sequence::Position_Traj_Sequence(const Position_Traj_Sequence& traj)
+  : Position_Traj_Interface(traj), _index(traj._index)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+  _traj_vec.reserve(traj._traj_vec.size());
+  for (const auto& element : traj._traj_vec)
+  {
+    _traj_vec.push_back(Position_Traj_Interface_Ptr(element->clone()));
+  }
+}
+
+/*
+    Blended path factory
+    Corner i (deflection angle theta, trim distance d): arc of radius d/tan(theta/2) from pi - d*u_in to pi + d*u_out
+    The speed ramps are v(t) = v*(3tau^2 - 2tau^3) (quintic with zero acceleration at the ends), the ramp length is
+    0.75*v^2/max_acceleration so that the peak tangential acceleration is max_acceleration
+*/
+Traj_Result<Position_Traj_Sequence> Position_Traj_Sequence::createBlended(const std::vector<Vector<3> >& waypoints,
+                                                                          double blend_radius, double speed,
+                                                                          double max_acceleration, double initial_time)
+{
+  const int n = waypoints.size();
+  if (n < 2 || !std::isfinite(blend_radius) || !std::isfinite(speed) || !std::isfinite(max_acceleration) ||
+      !std::isfinite(initial_time) || !(blend_radius > 0.0) || !(speed > 0.0) || !(max_acceleration > 0.0))
+  {
+    return TRAJ_INVALID_ARGUMENT;
+  }
+
+  // segments: length and direction
+  std::vector<double> length(n - 1);
+  std::vector<Vector<3> > dir(n - 1);
+  for (int i = 0; i < n - 1; i++)
+  {
+    const Vector<3> delta = waypoints[i + 1] - waypoints[i];
+    length[i] = norm(delta);
+    if (!std::isfinite(length[i]) || !(length[i] > 0.0))
+    {
+      return TRAJ_INVALID_ARGUMENT;
+    }
+    dir[i] = delta / length[i];
+  }
+
+  // corners: trim distance and deflection angle (trim[i] is the corner of waypoint i, 0 at the ends)
+  std::vector<double> trim(n, 0.0), angle(n, 0.0);
+  double max_speed = speed;
+  for (int i = 1; i < n - 1; i++)
+  {
+    const double cos_angle = std::max(-1.0, std::min(1.0, dir[i - 1] * dir[i]));
+    angle[i] = acos(cos_angle);
+    if (angle[i] < 1.0e-9)
+    {
+      // collinear segments, no blend
+      angle[i] = 0.0;
+      continue;
+    }
+    if (angle[i] > M_PI - 1.0e-6)
+    {
+      // the segment reverses the previous one, the velocity cannot be continuous without stopping
+      return TRAJ_INVALID_ARGUMENT;
+    }
+    trim[i] = std::min(blend_radius, 0.5 * std::min(length[i - 1], length[i]));
+    const double rho = trim[i] / tan(0.5 * angle[i]);
+    max_speed = std::min(max_speed, sqrt(max_acceleration * rho));
+  }
+
+  // ramps: the straight part of the first and the last segment has to contain them
+  const double first_straight = length[0] - trim[1];
+  const double last_straight = length[n - 2] - trim[n - 2];
+  if (n == 2)
+  {
+    max_speed = std::min(max_speed, sqrt(max_acceleration * length[0] / 1.5));
+  }
+  else
+  {
+    max_speed = std::min(max_speed, sqrt(max_acceleration * std::min(first_straight, last_straight) / 0.75));
+  }
+  const double v = max_speed;
+  const double ramp = 0.75 * v * v / max_acceleration;
+
+  Position_Traj_Sequence sequence;
+  sequence._traj_vec.reserve(2 * n + 1);
+  double t = initial_time;
+
+  // straight piece from pa to pb, the speed goes from va to vb (va = vb cruise, else ramp)
+  auto pushLine = [&](const Vector<3>& pa, const Vector<3>& pb, double va, double vb) {
+    const double l = norm(pb - pa);
+    if (!(l > 1.0e-12 * (1.0 + norm(pa))))
+    {
+      return;
+    }
+    const double duration = 2.0 * l / (va + vb);
+    sequence.push_back_traj(Line_Segment_Traj(pa, pb, Quintic_Poly_Traj(duration, 0.0, 1.0, t, va / l, vb / l)));
+    t += duration;
+  };
+
+  Vector<3> p = waypoints[0];
+  pushLine(p, p + ramp * dir[0], 0.0, v);
+  p = p + ramp * dir[0];
+  for (int i = 1; i < n - 1; i++)
+  {
+    const Vector<3> blend_start = waypoints[i] - trim[i] * dir[i - 1];
+    pushLine(p, blend_start, v, v);
+    p = blend_start;
+    if (trim[i] > 0.0)
+    {
+      const double rho = trim[i] / tan(0.5 * angle[i]);
+      const Vector<3> inward = unit(dir[i] - (dir[i - 1] * dir[i]) * dir[i - 1]);
+      const Vector<3> center = blend_start + rho * inward;
+      const double duration = rho * angle[i] / v;
+      sequence.push_back_traj(Position_Circumference_Traj(dir[i - 1] ^ inward, center, blend_start,
+                                                          Quintic_Poly_Traj(duration, 0.0, angle[i], t, v / rho,
+                                                                            v / rho)));
+      t += duration;
+      p = waypoints[i] + trim[i] * dir[i];
+    }
+  }
+  const Vector<3> ramp_start = waypoints[n - 1] - ramp * dir[n - 2];
+  pushLine(p, ramp_start, v, v);
+  pushLine(ramp_start, waypoints[n - 1], v, 0.0);
+
+  return sequence;
+}
+
+/*
+    Clone the object in the heap
+*/
+Position_Traj_Sequence* Position_Traj_Sequence::clone() const
+{
+  return new Position_Traj_Sequence(*this);
+}
+
+/* ====== END CONSTRUCTORS =======*/
+
+/* ====== SETTERS =========*/
+
+/*
+    Push back a trajectory in the sequence
+*/
+bool Position_Traj_Sequence::push_back_traj(const Position_Traj_Interface& traj)
+{
+  if (!_index.canPushBack(traj.getInitialTime()))
+  {
+    trajDiagnostic(TRAJ_DIAG_ERROR,
+                   "Error in Position_Traj_Sequence::push_back_traj() | initial time %f is before the last segment",
+                   traj.getInitialTime());
+    return false;
+  }
+  _traj_vec.push_back(Position_Traj_Interface_Ptr(traj.clone()));
+  _index.push_back(traj.getInitialTime(), traj.getFinalTime());
+  return true;
+}
+
+/*
+    Remove last traj of the sequence
+*/
+void Position_Traj_Sequence::pop_back_traj()
+{
+  _traj_vec.pop_back();
+  _index.pop_back();
+}
+
+/*
+    Remove all the trajs of the sequence
+*/
+void Position_Traj_Sequence::clear()
+{
+  _traj_vec.clear();
+  _index.clear();
+}
+
+/*
+    Change the initial time instant (translate all the trajectories in the time)
+*/
+void Position_Traj_Sequence::changeInitialTime(double initial_time)
+{
+  double Delta_T = initial_time - getInitialTime();
+  for (auto& element : _traj_vec)
+  {
+    element->changeInitialTime(element->getInitialTime() + Delta_T);
+  }
+  _index.shift(Delta_T);
+}
+
+/*
+    Set the mask of all the segments
+*/
+void Position_Traj_Sequence::setMask(Vector<3, int> mask)
+{
+  Position_Traj_Interface::setMask(mask);
+  for (auto& element : _traj_vec)
+  {
+    element->setMask(mask);
+  }
+}
+
+/* ====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of all the segments
+*/
+void Position_Traj_Sequence::changeFrame(const Matrix<4, 4>& new_T_curr)
+{
+  for (auto& element : _traj_vec)
+  {
+    element->changeFrame(new_T_curr);
+  }
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Get the mask of the active segment at time secs
+*/
+Vector<3, int> Position_Traj_Sequence::getMask(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getMask(secs);
+}
+
+/*
+    Number of segments
+*/
+int Position_Traj_Sequence::size() const
+{
+  return _traj_vec.size();
+}
+
+/*
+    Get the i-th segment
+*/
+const Position_Traj_Interface& Position_Traj_Sequence::getTraj(int i) const
+{
+  return *_traj_vec[i];
+}
+
+/*
+    Index of the active segment at time secs
+*/
+int Position_Traj_Sequence::getSegmentIndex(double secs) const
+{
+  return _index.find(secs);
+}
+
+/*
+    Get the final time instant
+*/
+double Position_Traj_Sequence::getFinalTime() const
+{
+  return _index.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Position_Traj_Sequence::getInitialTime() const
+{
+  return _index.getInitialTime();
+}
+
+/*====== END GETTERS =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Position at time secs
+*/
+Vector<3> Position_Traj_Sequence::getPosition(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getPosition(secs);
+}
+
+/*
+    Get Velocity at time secs
+*/
+Vector<3> Position_Traj_Sequence::getVelocity(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getVelocity(secs);
+}
+
+/*
+    Get Acceleration at time secs
+*/
+Vector<3> Position_Traj_Sequence::getAcceleration(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getAcceleration(secs);
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
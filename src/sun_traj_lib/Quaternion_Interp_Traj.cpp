@@ -0,0 +1,309 @@
+/*
+
+    Quaternion Interp Traj
+    Quaternion interpolation (slerp) driven by a scalar trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Quaternion_Interp_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+
+using namespace TooN;
+using namespace std;
+
+namespace sun
+{
+/*======CONSTRUCTORS=========*/
+
+/*
+    Full Constructor
+*/
+Quaternion_Interp_Traj::Quaternion_Interp_Traj(const UnitQuaternion &initial_quat, const UnitQuaternion &final_quat,
+                                               const Scalar_Traj_Interface &traj_s)
+  : Quaternion_Traj_Interface(NAN, NAN), _initial_quat(initial_quat), _final_quat(final_quat), _traj_s(traj_s)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+  updateLogMap();
+}
+
+/*
+    Copy Constructor, a non built-in traj of s is cloned in arena
+*/
+Quaternion_Interp_Traj::Quaternion_Interp_Traj(const Quaternion_Interp_Traj &traj, Traj_Arena &arena)
+  : Quaternion_Traj_Interface(NAN, NAN)
+  , _initial_quat(traj._initial_quat)
+  , _final_quat(traj._final_quat)
+  , _axis_quat(traj._axis_quat)
+  , _axis(traj._axis)
+  , _angle(traj._angle)
+  , _traj_s(traj._traj_s, arena)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+}
+
+/*
+    Clone the object in the heap
+*/
+Quaternion_Interp_Traj *Quaternion_Interp_Traj::clone() const
+{
+  return new Quaternion_Interp_Traj(*this);
+}
+
+/*
+    Clone the object in the arena
+*/
+Quaternion_Interp_Traj *Quaternion_Interp_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Quaternion_Interp_Traj>(*this, arena);
+}
+
+/*
+    Compute the log map from _initial_quat and _final_quat
+*/
+void Quaternion_Interp_Traj::updateLogMap()
+{
+  // Delta_Q = final_quat * inv(initial_quat) (base frame), w = angle/2 * axis
+  Vector<3> w = log(product(_final_quat, inv(_initial_quat)));
+  double half_angle = norm(w);
+  if (half_angle < 10.0 * std::numeric_limits<double>::epsilon())
+  {
+    // no rotation, _axis_quat is not used (sin(0) = 0)
+    _axis = Zeros;
+    _angle = 0.0;
+    _axis_quat = _initial_quat;
+  }
+  else
+  {
+    _axis = w / half_angle;
+    _angle = 2.0 * half_angle;
+    _axis_quat = product(UnitQuaternion(0.0, _axis), _initial_quat);
+  }
+}
+
+/*======END CONSTRUCTORS=========*/
+
+/*====== GETTERS =========*/
+
+UnitQuaternion Quaternion_Interp_Traj::getInitialQuat() const
+{
+  return _initial_quat;
+}
+
+UnitQuaternion Quaternion_Interp_Traj::getFinalQuat() const
+{
+  return _final_quat;
+}
+
+/*
+    Get rotation axis (base frame)
+*/
+Vector<3> Quaternion_Interp_Traj::getAxis() const
+{
+  return _axis;
+}
+
+/*
+    Get the total rotation angle in [0, pi]
+*/
+double Quaternion_Interp_Traj::getAngle() const
+{
+  return _angle;
+}
+
+/*
+    Get the final time instant
+*/
+double Quaternion_Interp_Traj::getFinalTime() const
+{
+  return _traj_s.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Quaternion_Interp_Traj::getInitialTime() const
+{
+  return _traj_s.getInitialTime();
+}
+
+/*====== END GETTERS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Change the initial time instant (translate the trajectory in the time)
+*/
+void Quaternion_Interp_Traj::changeInitialTime(double initial_time)
+{
+  _traj_s.changeInitialTime(initial_time);
+}
+
+/*
+    Trajectory for the s variable should be a traj from 0 to 1
+*/
+void Quaternion_Interp_Traj::setScalarTraj(const Scalar_Traj_Interface &traj_s)
+{
+  _traj_s = traj_s;
+}
+
+/*
+    Set the s trajectory taking ownership of traj_s
+*/
+void Quaternion_Interp_Traj::setScalarTraj(Scalar_Traj_Interface_Ptr &&traj_s)
+{
+  _traj_s = std::move(traj_s);
+}
+
+/*====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of the trajectory
+    Apply a rotation matrix to the trajectory
+*/
+void Quaternion_Interp_Traj::changeFrame(const Matrix<3, 3> &new_R_curr)
+{
+  changeFrame(UnitQuaternion(new_R_curr));
+}
+
+/*
+    Change the reference frame of the trajectory
+    Apply a rotation matrix to the trajectory
+*/
+void Quaternion_Interp_Traj::changeFrame(const UnitQuaternion &new_Q_curr)
+{
+  _initial_quat = new_Q_curr * _initial_quat;
+  _final_quat = new_Q_curr * _final_quat;
+  _axis = new_Q_curr * _axis;
+  _axis_quat = product(new_Q_curr, _axis_quat);
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+     Get Quaternion at s
+*/
+UnitQuaternion Quaternion_Interp_Traj::getQuaternionAt(double s) const
+{
+  double half_angle = 0.5 * s * _angle;
+  double c = cos(half_angle);
+  double sn = sin(half_angle);
+  return UnitQuaternion(c * _initial_quat.getS() + sn * _axis_quat.getS(),
+                        c * _initial_quat.getV() + sn * _axis_quat.getV());
+}
+
+/*
+     Get Quaternion at time secs
+*/
+UnitQuaternion Quaternion_Interp_Traj::getQuaternion(double secs) const
+{
+  return getQuaternionAt(_traj_s.getPosition(secs));
+}
+
+/*
+    Get Angular Velocity at time secs
+*/
+Vector<3> Quaternion_Interp_Traj::getVelocity(double secs) const
+{
+  return (_traj_s.getVelocity(secs) * _angle) * _axis;
+}
+
+/*
+    Get Angular Acceleration at time secs
+*/
+Vector<3> Quaternion_Interp_Traj::getAcceleration(double secs) const
+{
+  return (_traj_s.getAcceleration(secs) * _angle) * _axis;
+}
+
+/*====== END RUNNERS =========*/
+
+/*====== QUATERNION MAPS =========*/
+
+/*
+    Exponential map of the pure quaternion [0, w]
+*/
+UnitQuaternion Quaternion_Interp_Traj::exp(const Vector<3> &w)
+{
+  double angle = norm(w);
+  if (angle < 1.0e-8)
+  {
+    // cos(angle) ~ 1 - angle^2/2, sin(angle)/angle ~ 1
+    return UnitQuaternion(1.0 - 0.5 * angle * angle, w);
+  }
+  return UnitQuaternion(cos(angle), (sin(angle) / angle) * w);
+}
+
+/*
+    Log map of a unit quaternion, |w| in [0, pi/2] (shortest path)
+*/
+Vector<3> Quaternion_Interp_Traj::log(const UnitQuaternion &q)
+{
+  Vector<3> v = q.getV();
+  double sin_angle = norm(v);
+  if (sin_angle < 1.0e-8)
+  {
+    // q = +-1, the shortest path of -1 is the identity
+    Vector<3> w = v;
+    if (q.getS() < 0.0)
+      w *= -1.0;
+    return w;
+  }
+  double s = q.getS();
+  // shortest path: q and -q are the same rotation
+  if (s < 0.0)
+  {
+    s = -s;
+    v *= -1.0;
+  }
+  return (atan2(sin_angle, s) / sin_angle) * v;
+}
+
+/*
+    Quaternion product, the result is not normalized
+*/
+UnitQuaternion Quaternion_Interp_Traj::product(const UnitQuaternion &q1, const UnitQuaternion &q2)
+{
+  Vector<3> v1 = q1.getV();
+  Vector<3> v2 = q2.getV();
+  double s1 = q1.getS();
+  double s2 = q2.getS();
+  Vector<3> v = s2 * v1;
+  v += s1 * v2;
+  v += v1 ^ v2;
+  return UnitQuaternion(s1 * s2 - v1 * v2, v);
+}
+
+/*
+    Dot product of the quaternions as 4-vectors
+*/
+double Quaternion_Interp_Traj::dot(const UnitQuaternion &q1, const UnitQuaternion &q2)
+{
+  return q1.getS() * q2.getS() + q1.getV() * q2.getV();
+}
+
+/*====== END QUATERNION MAPS =========*/
+
+}  // namespace sun
@@ -0,0 +1,502 @@
+/*
+
+    Quaternion Squad Traj
+    Smooth quaternion trajectory through waypoints (SQUAD) driven by a scalar trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Quaternion_Squad_Traj.h"
+
+using namespace TooN;
+using namespace std;
+
+namespace sun
+{
+/*
+    Short names of the maps
+*/
+static inline UnitQuaternion qexp(const Vector<3> &w)
+{
+  return Quaternion_Interp_Traj::exp(w);
+}
+
+static inline Vector<3> qlog(const UnitQuaternion &q)
+{
+  return Quaternion_Interp_Traj::log(q);
+}
+
+static inline UnitQuaternion qmul(const UnitQuaternion &q1, const UnitQuaternion &q2)
+{
+  return Quaternion_Interp_Traj::product(q1, q2);
+}
+
+/*
+    Conjugate (inverse of a unit quaternion)
+*/
+static inline UnitQuaternion qconj(const UnitQuaternion &q)
+{
+  return UnitQuaternion(q.getS(), -q.getV());
+}
+
+/*
+    Quaternion that is not unit (a derivative w.r.t. the segment parameter u)
+*/
+struct Squad_Quat
+{
+  double s;
+  Vector<3> v;
+};
+
+static inline Squad_Quat dmul(const Squad_Quat &q1, const Squad_Quat &q2)
+{
+  Squad_Quat q;
+  q.s = q1.s * q2.s - q1.v * q2.v;
+  q.v = q2.s * q1.v;
+  q.v += q1.s * q2.v;
+  q.v += q1.v ^ q2.v;
+  return q;
+}
+
+/*
+    Value, first and second derivative w.r.t. u of a scalar (forward mode differentiation)
+*/
+struct Squad_Jet
+{
+  double v, d, dd;
+};
+
+static inline Squad_Jet jet(double v, double d, double dd)
+{
+  Squad_Jet j;
+  j.v = v;
+  j.d = d;
+  j.dd = dd;
+  return j;
+}
+
+static inline Squad_Jet operator+(const Squad_Jet &a, const Squad_Jet &b)
+{
+  return jet(a.v + b.v, a.d + b.d, a.dd + b.dd);
+}
+
+static inline Squad_Jet operator-(const Squad_Jet &a, const Squad_Jet &b)
+{
+  return jet(a.v - b.v, a.d - b.d, a.dd - b.dd);
+}
+
+static inline Squad_Jet operator*(const Squad_Jet &a, const Squad_Jet &b)
+{
+  return jet(a.v * b.v, a.d * b.v + a.v * b.d, a.dd * b.v + 2.0 * a.d * b.d + a.v * b.dd);
+}
+
+static inline Squad_Jet operator*(double c, const Squad_Jet &a)
+{
+  return jet(c * a.v, c * a.d, c * a.dd);
+}
+
+/*
+    f(a) given f, f' and f'' at a.v (chain rule)
+*/
+static inline Squad_Jet chain(const Squad_Jet &a, double f, double df, double ddf)
+{
+  return jet(f, df * a.d, ddf * a.d * a.d + df * a.dd);
+}
+
+static inline Squad_Jet inverse(const Squad_Jet &a)
+{
+  const double inv = 1.0 / a.v;
+  return chain(a, inv, -inv * inv, 2.0 * inv * inv * inv);
+}
+
+/*
+    atan2(y, x), y and x are not both zero
+*/
+static inline Squad_Jet atan2(const Squad_Jet &y, const Squad_Jet &x)
+{
+  const double r = x.v * x.v + y.v * y.v;
+  const double n = x.v * y.d - y.v * x.d;
+  const double dn = x.v * y.dd - y.v * x.dd;
+  const double dr = 2.0 * (x.v * x.d + y.v * y.d);
+  return jet(std::atan2(y.v, x.v), n / r, (dn * r - n * dr) / (r * r));
+}
+
+/*======CONSTRUCTORS=========*/
+
+/*
+    Full Constructor
+*/
+Quaternion_Squad_Traj::Quaternion_Squad_Traj(const vector<UnitQuaternion> &waypoints,
+                                             const Scalar_Traj_Interface &traj_s)
+  : Quaternion_Traj_Interface(NAN, NAN), _waypoints(waypoints), _traj_s(traj_s)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+  if (_waypoints.size() < 2)
+  {
+    trajFatal("Error in Quaternion_Squad_Traj() at least 2 waypoints are needed (%d given)", int(_waypoints.size()));
+    // fallback: constant traj
+    if (_waypoints.empty())
+      _waypoints.push_back(UnitQuaternion());
+    _waypoints.push_back(_waypoints.back());
+  }
+  updateControls();
+}
+
+/*
+    Clone the object in the heap
+*/
+Quaternion_Squad_Traj *Quaternion_Squad_Traj::clone() const
+{
+  return new Quaternion_Squad_Traj(*this);
+}
+
+/*
+    Compute the control quaternions and the logs from _waypoints
+*/
+void Quaternion_Squad_Traj::updateControls()
+{
+  const size_t n = _waypoints.size();
+
+  // same hemisphere of the previous waypoint (shortest path between consecutive waypoints)
+  for (size_t i = 1; i < n; i++)
+  {
+    if (Quaternion_Interp_Traj::dot(_waypoints[i - 1], _waypoints[i]) < 0.0)
+    {
+      _waypoints[i] = UnitQuaternion(-_waypoints[i].getS(), -_waypoints[i].getV());
+    }
+  }
+
+  _log_waypoints.resize(n - 1);
+  for (size_t i = 0; i + 1 < n; i++)
+  {
+    _log_waypoints[i] = qlog(qmul(qconj(_waypoints[i]), _waypoints[i + 1]));
+  }
+
+  _controls.resize(n);
+  _controls[0] = _waypoints[0];
+  _controls[n - 1] = _waypoints[n - 1];
+  for (size_t i = 1; i + 1 < n; i++)
+  {
+    // log(q_i^-1 q_i-1) = -log(q_i-1^-1 q_i)
+    Vector<3> w = _log_waypoints[i] - _log_waypoints[i - 1];
+    w *= -0.25;
+    _controls[i] = qmul(_waypoints[i], qexp(w));
+  }
+
+  _log_controls.resize(n - 1);
+  for (size_t i = 0; i + 1 < n; i++)
+  {
+    _log_controls[i] = qlog(qmul(qconj(_controls[i]), _controls[i + 1]));
+  }
+}
+
+/*======END CONSTRUCTORS=========*/
+
+/*====== GETTERS =========*/
+
+int Quaternion_Squad_Traj::getNumWaypoints() const
+{
+  return _waypoints.size();
+}
+
+/*
+    Get the waypoint i (aligned to the hemisphere of the previous one)
+*/
+UnitQuaternion Quaternion_Squad_Traj::getWaypoint(int i) const
+{
+  return _waypoints[i];
+}
+
+/*
+    Get the final time instant
+*/
+double Quaternion_Squad_Traj::getFinalTime() const
+{
+  return _traj_s.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Quaternion_Squad_Traj::getInitialTime() const
+{
+  return _traj_s.getInitialTime();
+}
+
+/*====== END GETTERS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Change the initial time instant (translate the trajectory in the time)
+*/
+void Quaternion_Squad_Traj::changeInitialTime(double initial_time)
+{
+  _traj_s.changeInitialTime(initial_time);
+}
+
+/*
+    Trajectory for the s variable should be a traj from 0 to N-1
+*/
+void Quaternion_Squad_Traj::setScalarTraj(const Scalar_Traj_Interface &traj_s)
+{
+  _traj_s = traj_s;
+}
+
+/*
+    Set the s trajectory taking ownership of traj_s
+*/
+void Quaternion_Squad_Traj::setScalarTraj(Scalar_Traj_Interface_Ptr &&traj_s)
+{
+  _traj_s = std::move(traj_s);
+}
+
+/*====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of the trajectory
+    Apply a rotation matrix to the trajectory
+*/
+void Quaternion_Squad_Traj::changeFrame(const Matrix<3, 3> &new_R_curr)
+{
+  changeFrame(UnitQuaternion(new_R_curr));
+}
+
+/*
+    Change the reference frame of the trajectory
+    Apply a rotation matrix to the trajectory
+    The logs are relative rotations (local frame), they do not change
+*/
+void Quaternion_Squad_Traj::changeFrame(const UnitQuaternion &new_Q_curr)
+{
+  for (auto &q : _waypoints)
+  {
+    q = qmul(new_Q_curr, q);
+  }
+  for (auto &a : _controls)
+  {
+    a = qmul(new_Q_curr, a);
+  }
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Quaternion of the segment i at u (u is not clamped)
+*/
+UnitQuaternion Quaternion_Squad_Traj::squad(int i, double u) const
+{
+  UnitQuaternion q = qmul(_waypoints[i], qexp(u * _log_waypoints[i]));
+  UnitQuaternion a = qmul(_controls[i], qexp(u * _log_controls[i]));
+  return qmul(q, qexp((2.0 * u * (1.0 - u)) * qlog(qmul(qconj(q), a))));
+}
+
+/*
+    Segment of s and parameter in the segment
+*/
+int Quaternion_Squad_Traj::segment(double s, double &u) const
+{
+  const int last = int(_waypoints.size()) - 2;
+  if (!(s > 0.0))
+  {
+    u = 0.0;
+    return 0;
+  }
+  if (s >= last + 1)
+  {
+    u = 1.0;
+    return last;
+  }
+  int i = int(s);
+  if (i > last)
+    i = last;
+  u = s - i;
+  return i;
+}
+
+/*
+     Get Quaternion at s (s is clamped in [0, N-1])
+*/
+UnitQuaternion Quaternion_Squad_Traj::getQuaternionAt(double s) const
+{
+  double u;
+  int i = segment(s, u);
+  return squad(i, u);
+}
+
+/*
+     Get Quaternion at time secs
+*/
+UnitQuaternion Quaternion_Squad_Traj::getQuaternion(double secs) const
+{
+  return getQuaternionAt(_traj_s.getPosition(secs));
+}
+
+/*
+    Angular velocity and acceleration (base frame) from the derivatives of q w.r.t. s
+    dq/dt = 1/2 [0, w] q  ->  w = 2 vec(dq/dt q*),  dw/dt = 2 vec(d2q/dt2 q*)
+    The derivatives w.r.t. u of squad = q e, with q = q_i exp(u L), a = a_i exp(u M),
+    p = q* a and e = exp(g log(p)), g = 2u(1-u), are exact:
+    q' = q [0,L], q'' = -|L|^2 q, p' = p [0,M] - [0,L] p, p'' = p' [0,M] - [0,L] p'
+    and e = [cos(g th), sin(g th)/|vec(p)| vec(p)], th = atan2(|vec(p)|, p_s), is differentiated with jets
+    (for a small th the Taylor series in th^2 is used, e is smooth where p crosses the identity)
+*/
+void Quaternion_Squad_Traj::getDerivatives(double secs, Vector<3> *velocity, Vector<3> *acceleration) const
+{
+  Scalar_Traj_State s = _traj_s.getState(secs);
+  double u;
+  int i = segment(s.position, u);
+
+  const Vector<3> &log_q = _log_waypoints[i];
+  const Vector<3> &log_a = _log_controls[i];
+  const UnitQuaternion q_unit = qmul(_waypoints[i], qexp(u * log_q));
+  const UnitQuaternion a_unit = qmul(_controls[i], qexp(u * log_a));
+  const Squad_Quat q = { q_unit.getS(), q_unit.getV() };
+  const Squad_Quat a = { a_unit.getS(), a_unit.getV() };
+  const Squad_Quat l = { 0.0, log_q };
+  const Squad_Quat m = { 0.0, log_a };
+
+  const Squad_Quat q_conj = { q.s, -q.v };
+  Squad_Quat p = dmul(q_conj, a);
+  Squad_Quat dp = dmul(p, m);
+  {
+    const Squad_Quat lp = dmul(l, p);
+    dp.s -= lp.s;
+    dp.v -= lp.v;
+  }
+  Squad_Quat ddp = dmul(dp, m);
+  {
+    const Squad_Quat ldp = dmul(l, dp);
+    ddp.s -= ldp.s;
+    ddp.v -= ldp.v;
+  }
+  // shortest path (as in log()): p and -p are the same rotation
+  if (p.s < 0.0)
+  {
+    p.s = -p.s;
+    p.v *= -1.0;
+    dp.s = -dp.s;
+    dp.v *= -1.0;
+    ddp.s = -ddp.s;
+    ddp.v *= -1.0;
+  }
+
+  const Squad_Jet g = jet(2.0 * u * (1.0 - u), 2.0 - 4.0 * u, -4.0);
+  const Squad_Jet p_s = jet(p.s, dp.s, ddp.s);
+  // |vec(p)|^2
+  const Squad_Jet x = jet(p.v * p.v, 2.0 * (p.v * dp.v), 2.0 * (dp.v * dp.v + p.v * ddp.v));
+
+  // e = [e_s, k vec(p)]
+  Squad_Jet e_s, k;
+  if (x.v > QUATERNION_SQUAD_SERIES_TOL * p.s * p.s)
+  {
+    const double sqrt_x = std::sqrt(x.v);
+    const Squad_Jet norm_v = chain(x, sqrt_x, 0.5 / sqrt_x, -0.25 / (x.v * sqrt_x));
+    const Squad_Jet angle = g * atan2(norm_v, p_s);
+    e_s = chain(angle, cos(angle.v), -sin(angle.v), -cos(angle.v));
+    k = chain(angle, sin(angle.v), cos(angle.v), -sin(angle.v)) * inverse(norm_v);
+  }
+  else
+  {
+    // th^2 = tan^2(th) + O(th^4),  cos(g th) = 1 - g^2 th^2 / 2,  k = g/p_s (1 - (g^2/6 + 1/3) th^2)
+    const Squad_Jet inv_p_s = inverse(p_s);
+    const Squad_Jet th2 = x * inv_p_s * inv_p_s;
+    const Squad_Jet g2 = g * g;
+    const Squad_Jet one = jet(1.0, 0.0, 0.0);
+    e_s = one - 0.5 * (g2 * th2);
+    k = g * inv_p_s * (one - ((1.0 / 6.0) * g2 + (1.0 / 3.0) * one) * th2);
+  }
+
+  const Squad_Quat e = { e_s.v, k.v * p.v };
+  Squad_Quat de = { e_s.d, k.d * p.v };
+  de.v += k.v * dp.v;
+  Squad_Quat dde = { e_s.dd, k.dd * p.v };
+  dde.v += (2.0 * k.d) * dp.v;
+  dde.v += k.v * ddp.v;
+
+  // squad = q e, its derivatives w.r.t. u (= derivatives w.r.t. s)
+  const Squad_Quat dq = dmul(q, l);
+  const Squad_Quat sq = dmul(q, e);
+  Squad_Quat dsq = dmul(dq, e);
+  {
+    const Squad_Quat q_de = dmul(q, de);
+    dsq.s += q_de.s;
+    dsq.v += q_de.v;
+  }
+  Squad_Quat ddsq = dmul(q, dde);
+  {
+    // q'' e = -|L|^2 q e
+    const Squad_Quat dq_de = dmul(dq, de);
+    const double norm2_l = log_q * log_q;
+    ddsq.s += 2.0 * dq_de.s - norm2_l * sq.s;
+    ddsq.v += 2.0 * dq_de.v;
+    ddsq.v -= norm2_l * sq.v;
+  }
+
+  const Vector<3> q_v = sq.v;
+  const double q_s = sq.s;
+  // 2 vec(x q*) with x = [x_s, x_v]
+  auto twiceVec = [&](double x_s, const Vector<3> &x_v) -> Vector<3> {
+    Vector<3> out = q_s * x_v;
+    out -= x_s * q_v;
+    out -= x_v ^ q_v;
+    out *= 2.0;
+    return out;
+  };
+
+  if (velocity)
+  {
+    *velocity = s.velocity * twiceVec(dsq.s, dsq.v);
+  }
+  if (acceleration)
+  {
+    double s_dot_2 = s.velocity * s.velocity;
+    *acceleration =
+        twiceVec(s_dot_2 * ddsq.s + s.acceleration * dsq.s, s_dot_2 * ddsq.v + s.acceleration * dsq.v);
+  }
+}
+
+/*
+    Get Angular Velocity at time secs
+*/
+Vector<3> Quaternion_Squad_Traj::getVelocity(double secs) const
+{
+  Vector<3> velocity;
+  getDerivatives(secs, &velocity, nullptr);
+  return velocity;
+}
+
+/*
+    Get Angular Acceleration at time secs
+*/
+Vector<3> Quaternion_Squad_Traj::getAcceleration(double secs) const
+{
+  Vector<3> acceleration;
+  getDerivatives(secs, nullptr, &acceleration);
+  return acceleration;
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
@@ -0,0 +1,237 @@
+/*
+
+    Quaternion Traj Sequence
+    Quaternion traj made of a sequence of quaternion trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Quaternion_Traj_Sequence.h"
+
+using namespace TooN;
+
+namespace sun
+{
+/* ====== CONSTRUCTORS =======*/
+
+/*
+    Void Constructor (empty sequence)
+*/
+Quaternion_Traj_Sequence::Quaternion_Traj_Sequence() : Quaternion_Traj_Interface(NAN, NAN)
+{
+}
+
+/*
+    Full constructor
+*/
+Quaternion_Traj_Sequence::Quaternion_Traj_Sequence(const std::vector<Quaternion_Traj_Interface_Ptr>& traj_vec)
+  : Quaternion_Traj_Interface(NAN, NAN)
+{
+  _traj_vec.reserve(traj_vec.size());
+  for (const auto& element : traj_vec)
+  {
+    push_back_traj(*element);
+  }
+}
+
+/*
+    Copy Constructor
+*/
+Quaternion_Traj_Sequence::Quaternion_Traj_Sequence(const Quaternion_Traj_Sequence& traj)
+  : Quaternion_Traj_Interface(traj), _index(traj._index)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+  _traj_vec.reserve(traj._traj_vec.size());
+  for (const auto& element : traj._traj_vec)
+  {
+    _traj_vec.push_back(Quaternion_Traj_Interface_Ptr(element->clone()));
+  }
+}
+
+/*
+    Clone the object in the heap
+*/
+Quaternion_Traj_Sequence* Quaternion_Traj_Sequence::clone() const
+{
+  return new Quaternion_Traj_Sequence(*this);
+}
+
+/* ====== END CONSTRUCTORS =======*/
+
+/* ====== SETTERS =========*/
+
+/*
+    Push back a trajectory in the sequence
+*/
+bool Quaternion_Traj_Sequence::push_back_traj(const Quaternion_Traj_Interface& traj)
+{
+  if (!_index.canPushBack(traj.getInitialTime()))
+  {
+    trajDiagnostic(TRAJ_DIAG_ERROR,
+                   "Error in Quaternion_Traj_Sequence::push_back_traj() | initial time %f is before the last segment",
+                   traj.getInitialTime());
+    return false;
+  }
+  _traj_vec.push_back(Quaternion_Traj_Interface_Ptr(traj.clone()));
+  _index.push_back(traj.getInitialTime(), traj.getFinalTime());
+  return true;
+}
+
+/*
+    Remove last traj of the sequence
+*/
+void Quaternion_Traj_Sequence::pop_back_traj()
+{
+  _traj_vec.pop_back();
+  _index.pop_back();
+}
+
+/*
+    Remove all the trajs of the sequence
+*/
+void Quaternion_Traj_Sequence::clear()
+{
+  _traj_vec.clear();
+  _index.clear();
+}
+
+/*
+    Change the initial time instant (translate all the trajectories in the time)
+*/
+void Quaternion_Traj_Sequence::changeInitialTime(double initial_time)
+{
+  double Delta_T = initial_time - getInitialTime();
+  for (auto& element : _traj_vec)
+  {
+    element->changeInitialTime(element->getInitialTime() + Delta_T);
+  }
+  _index.shift(Delta_T);
+}
+
+/*
+    Set the mask of all the segments
+*/
+void Quaternion_Traj_Sequence::setMask(Vector<3, int> mask)
+{
+  Quaternion_Traj_Interface::setMask(mask);
+  for (auto& element : _traj_vec)
+  {
+    element->setMask(mask);
+  }
+}
+
+/* ====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of all the segments
+*/
+void Quaternion_Traj_Sequence::changeFrame(const Matrix<3, 3>& new_R_curr)
+{
+  for (auto& element : _traj_vec)
+  {
+    element->changeFrame(new_R_curr);
+  }
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Get the mask of the active segment at time secs
+*/
+Vector<3, int> Quaternion_Traj_Sequence::getMask(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getMask(secs);
+}
+
+/*
+    Number of segments
+*/
+int Quaternion_Traj_Sequence::size() const
+{
+  return _traj_vec.size();
+}
+
+/*
+    Get the i-th segment
+*/
+const Quaternion_Traj_Interface& Quaternion_Traj_Sequence::getTraj(int i) const
+{
+  return *_traj_vec[i];
+}
+
+/*
+    Index of the active segment at time secs
+*/
+int Quaternion_Traj_Sequence::getSegmentIndex(double secs) const
+{
+  return _index.find(secs);
+}
+
+/*
+    Get the final time instant
+*/
+double Quaternion_Traj_Sequence::getFinalTime() const
+{
+  return _index.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Quaternion_Traj_Sequence::getInitialTime() const
+{
+  return _index.getInitialTime();
+}
+
+/*====== END GETTERS =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Quaternion at time secs
+*/
+UnitQuaternion Quaternion_Traj_Sequence::getQuaternion(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getQuaternion(secs);
+}
+
+/*
+    Get Angular Velocity at time secs
+*/
+Vector<3> Quaternion_Traj_Sequence::getVelocity(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getVelocity(secs);
+}
+
+/*
+    Get Angular Acceleration at time secs
+*/
+Vector<3> Quaternion_Traj_Sequence::getAcceleration(double secs) const
+{
+  return _traj_vec[_index.find(secs)]->getAcceleration(secs);
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
@@ -23,12 +23,192 @@
 */
 
 #include "sun_traj_lib/Quintic_Poly_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 using namespace TooN;
 using namespace std;
 
 namespace sun
 {
+/*======= EVALUATION KERNELS =========*/
+
+/*
+    Data used by the state kernels
+    p/v/a coefficients are in descending order (as in polyval)
+*/
+struct Quintic_Poly_Kernel_Data
+{
+  double p[6];
+  double v[5];
+  double a[4];
+  double ti, tf, pi, pf;
+};
+
+/*
+    Scalar kernel: evaluates p, v and a on secs[begin..n-1]
+*/
+static void quintic_state_kernel_scalar(const Quintic_Poly_Kernel_Data &k, const double *secs, double *pos,
+                                        double *vel, double *acc, int begin, int n)
+{
+  for (int i = begin; i < n; i++)
+  {
+    if (secs[i] < k.ti)
+    {
+      pos[i] = k.pi;
+      vel[i] = 0.0;
+      acc[i] = 0.0;
+      continue;
+    }
+    if (secs[i] > k.tf)
+    {
+      pos[i] = k.pf;
+      vel[i] = 0.0;
+      acc[i] = 0.0;
+      continue;
+    }
+    const double t = secs[i] - k.ti;
+    pos[i] = ((((k.p[0] * t + k.p[1]) * t + k.p[2]) * t + k.p[3]) * t + k.p[4]) * t + k.p[5];
+    vel[i] = (((k.v[0] * t + k.v[1]) * t + k.v[2]) * t + k.v[3]) * t + k.v[4];
+    acc[i] = ((k.a[0] * t + k.a[1]) * t + k.a[2]) * t + k.a[3];
+  }
+}
+
+#if defined(__AVX__)
+
+#if defined(__FMA__)
+#define QUINTIC_MADD(a, b, c) _mm256_fmadd_pd(a, b, c)
+#else
+#define QUINTIC_MADD(a, b, c) _mm256_add_pd(_mm256_mul_pd(a, b), c)
+#endif
+
+/*
+    AVX kernel: evaluates 4 time samples per step
+*/
+static inline void quintic_state_kernel_avx_4(const Quintic_Poly_Kernel_Data &k, const double *secs, double *pos,
+                                              double *vel, double *acc)
+{
+  const __m256d s = _mm256_loadu_pd(secs);
+  const __m256d ti = _mm256_set1_pd(k.ti);
+  const __m256d t = _mm256_sub_pd(s, ti);
+
+  __m256d p = _mm256_set1_pd(k.p[0]);
+  p = QUINTIC_MADD(p, t, _mm256_set1_pd(k.p[1]));
+  p = QUINTIC_MADD(p, t, _mm256_set1_pd(k.p[2]));
+  p = QUINTIC_MADD(p, t, _mm256_set1_pd(k.p[3]));
+  p = QUINTIC_MADD(p, t, _mm256_set1_pd(k.p[4]));
+  p = QUINTIC_MADD(p, t, _mm256_set1_pd(k.p[5]));
+
+  __m256d v = _mm256_set1_pd(k.v[0]);
+  v = QUINTIC_MADD(v, t, _mm256_set1_pd(k.v[1]));
+  v = QUINTIC_MADD(v, t, _mm256_set1_pd(k.v[2]));
+  v = QUINTIC_MADD(v, t, _mm256_set1_pd(k.v[3]));
+  v = QUINTIC_MADD(v, t, _mm256_set1_pd(k.v[4]));
+
+  __m256d a = _mm256_set1_pd(k.a[0]);
+  a = QUINTIC_MADD(a, t, _mm256_set1_pd(k.a[1]));
+  a = QUINTIC_MADD(a, t, _mm256_set1_pd(k.a[2]));
+  a = QUINTIC_MADD(a, t, _mm256_set1_pd(k.a[3]));
+
+  // out of [ti, tf] -> hold initial/final position, zero derivatives
+  const __m256d before = _mm256_cmp_pd(s, ti, _CMP_LT_OQ);
+  const __m256d after = _mm256_cmp_pd(s, _mm256_set1_pd(k.tf), _CMP_GT_OQ);
+  const __m256d outside = _mm256_or_pd(before, after);
+  p = _mm256_blendv_pd(p, _mm256_set1_pd(k.pi), before);
+  p = _mm256_blendv_pd(p, _mm256_set1_pd(k.pf), after);
+
+  _mm256_storeu_pd(pos, p);
+  _mm256_storeu_pd(vel, _mm256_andnot_pd(outside, v));
+  _mm256_storeu_pd(acc, _mm256_andnot_pd(outside, a));
+}
+
+#undef QUINTIC_MADD
+
+static void quintic_state_kernel(const Quintic_Poly_Kernel_Data &k, const double *secs, double *pos, double *vel,
+                                 double *acc, int n)
+{
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    // two independent Horner chains to hide the FMA latency
+    quintic_state_kernel_avx_4(k, secs + i, pos + i, vel + i, acc + i);
+    quintic_state_kernel_avx_4(k, secs + i + 4, pos + i + 4, vel + i + 4, acc + i + 4);
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    quintic_state_kernel_avx_4(k, secs + i, pos + i, vel + i, acc + i);
+  }
+  quintic_state_kernel_scalar(k, secs, pos, vel, acc, i, n);
+}
+
+#elif defined(__SSE2__)
+
+/*
+    SSE2 kernel: evaluates 2 time samples per step
+*/
+static inline void quintic_state_kernel_sse2_2(const Quintic_Poly_Kernel_Data &k, const double *secs, double *pos,
+                                               double *vel, double *acc)
+{
+  const __m128d s = _mm_loadu_pd(secs);
+  const __m128d ti = _mm_set1_pd(k.ti);
+  const __m128d t = _mm_sub_pd(s, ti);
+
+  __m128d p = _mm_set1_pd(k.p[0]);
+  for (int j = 1; j < 6; j++)
+  {
+    p = _mm_add_pd(_mm_mul_pd(p, t), _mm_set1_pd(k.p[j]));
+  }
+  __m128d v = _mm_set1_pd(k.v[0]);
+  for (int j = 1; j < 5; j++)
+  {
+    v = _mm_add_pd(_mm_mul_pd(v, t), _mm_set1_pd(k.v[j]));
+  }
+  __m128d a = _mm_set1_pd(k.a[0]);
+  for (int j = 1; j < 4; j++)
+  {
+    a = _mm_add_pd(_mm_mul_pd(a, t), _mm_set1_pd(k.a[j]));
+  }
+
+  // out of [ti, tf] -> hold initial/final position, zero derivatives
+  const __m128d before = _mm_cmplt_pd(s, ti);
+  const __m128d after = _mm_cmpgt_pd(s, _mm_set1_pd(k.tf));
+  const __m128d outside = _mm_or_pd(before, after);
+  p = _mm_or_pd(_mm_andnot_pd(outside, p),
+                _mm_or_pd(_mm_and_pd(before, _mm_set1_pd(k.pi)), _mm_and_pd(after, _mm_set1_pd(k.pf))));
+
+  _mm_storeu_pd(pos, p);
+  _mm_storeu_pd(vel, _mm_andnot_pd(outside, v));
+  _mm_storeu_pd(acc, _mm_andnot_pd(outside, a));
+}
+
+static void quintic_state_kernel(const Quintic_Poly_Kernel_Data &k, const double *secs, double *pos, double *vel,
+                                 double *acc, int n)
+{
+  int i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    quintic_state_kernel_sse2_2(k, secs + i, pos + i, vel + i, acc + i);
+  }
+  quintic_state_kernel_scalar(k, secs, pos, vel, acc, i, n);
+}
+
+#else
+
+static void quintic_state_kernel(const Quintic_Poly_Kernel_Data &k, const double *secs, double *pos, double *vel,
+                                 double *acc, int n)
+{
+  quintic_state_kernel_scalar(k, secs, pos, vel, acc, 0, n);
+}
+
+#endif
+
+/*======= END EVALUATION KERNELS =========*/
+
 /*=======CONSTRUCTORS======*/
 
 /*
@@ -48,6 +228,22 @@ Quintic_Poly_Traj::Quintic_Poly_Traj(double duration, double initial_position, d
   updateCoefficients();
 }
 
+/*
+    Non-fatal factory, validate the inputs and return the traj or an error status
+*/
+Traj_Result<Quintic_Poly_Traj> Quintic_Poly_Traj::create(double duration, double initial_position,
+                                                         double final_position, double initial_time,
+                                                         double initial_velocity, double final_velocity,
+                                                         double initial_acceleration, double final_acceleration)
+{
+  if (!(duration >= 0.0))
+  {
+    return TRAJ_INVALID_DURATION;
+  }
+  return Quintic_Poly_Traj(duration, initial_position, final_position, initial_time, initial_velocity,
+                           final_velocity, initial_acceleration, final_acceleration);
+}
+
 /*
     Clone the object in the heap
 */
@@ -56,6 +252,14 @@ Quintic_Poly_Traj *Quintic_Poly_Traj::clone() const
   return new Quintic_Poly_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+Quintic_Poly_Traj *Quintic_Poly_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Quintic_Poly_Traj>(*this);
+}
+
 /*=======END CONSTRUCTORS======*/
 
 /*======= GETTERS =========*/
@@ -90,6 +294,11 @@ double Quintic_Poly_Traj::getFinalAcceleration() const
   return _acf;
 }
 
+Vector<6> Quintic_Poly_Traj::getPolyCoeff() const
+{
+  return _poly_coeff;
+}
+
 /*======= END GETTERS =========*/
 
 /*======SETTERS==========*/
@@ -142,51 +351,76 @@ void Quintic_Poly_Traj::changeInitialTime(double initial_time)
 /*======END SETTERS==========*/
 
 /*
-    Get Position at time secs
+    Get Position at the n time instants secs[0..n-1]
 */
-double Quintic_Poly_Traj::getPosition(double secs) const
+void Quintic_Poly_Traj::getPositionBatch(const double *secs, double *out, int n) const
 {
-  if (secs < _initial_time)
+  const double ti = _initial_time, tf = _final_time, pi = _pi, pf = _pf;
+  const double c0 = _poly_coeff[0], c1 = _poly_coeff[1], c2 = _poly_coeff[2], c3 = _poly_coeff[3],
+               c4 = _poly_coeff[4], c5 = _poly_coeff[5];
+  for (int i = 0; i < n; i++)
   {
-    return _pi;
+    const double t = secs[i] - ti;
+    const double p = ((((c0 * t + c1) * t + c2) * t + c3) * t + c4) * t + c5;
+    out[i] = (secs[i] < ti) ? pi : ((secs[i] > tf) ? pf : p);
   }
-  if (secs > _final_time)
-  {
-    return _pf;
-  }
-  return polyval(_poly_coeff, secs - _initial_time);
 }
 
 /*
-    Get Velocity at time secs
+    Get Velocity at the n time instants secs[0..n-1]
 */
-double Quintic_Poly_Traj::getVelocity(double secs) const
+void Quintic_Poly_Traj::getVelocityBatch(const double *secs, double *out, int n) const
 {
-  if (secs < _initial_time)
+  const double ti = _initial_time, tf = _final_time;
+  const double c0 = _vel_poly_coeff[0], c1 = _vel_poly_coeff[1], c2 = _vel_poly_coeff[2], c3 = _vel_poly_coeff[3],
+               c4 = _vel_poly_coeff[4];
+  for (int i = 0; i < n; i++)
   {
-    return 0.0;
+    const double t = secs[i] - ti;
+    const double v = (((c0 * t + c1) * t + c2) * t + c3) * t + c4;
+    out[i] = (secs[i] < ti || secs[i] > tf) ? 0.0 : v;
   }
-  if (secs > _final_time)
+}
+
+/*
+    Get Acceleration at the n time instants secs[0..n-1]
+*/
+void Quintic_Poly_Traj::getAccelerationBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, tf = _final_time;
+  const double c0 = _acc_poly_coeff[0], c1 = _acc_poly_coeff[1], c2 = _acc_poly_coeff[2], c3 = _acc_poly_coeff[3];
+  for (int i = 0; i < n; i++)
   {
-    return 0.0;
+    const double t = secs[i] - ti;
+    const double a = ((c0 * t + c1) * t + c2) * t + c3;
+    out[i] = (secs[i] < ti || secs[i] > tf) ? 0.0 : a;
   }
-  return polyval(_vel_poly_coeff, secs - _initial_time);
 }
 
 /*
-    Get Acceleration at time secs
+    Get Position, Velocity and Acceleration at the n time instants secs[0..n-1]
 */
-double Quintic_Poly_Traj::getAcceleration(double secs) const
+void Quintic_Poly_Traj::getStateBatch(const double *secs, double *pos, double *vel, double *acc, int n) const
 {
-  if (secs < _initial_time)
+  Quintic_Poly_Kernel_Data k;
+  for (int j = 0; j < 6; j++)
+  {
+    k.p[j] = _poly_coeff[j];
+  }
+  for (int j = 0; j < 5; j++)
   {
-    return 0.0;
+    k.v[j] = _vel_poly_coeff[j];
   }
-  if (secs > _final_time)
+  for (int j = 0; j < 4; j++)
   {
-    return 0.0;
+    k.a[j] = _acc_poly_coeff[j];
   }
-  return polyval(_acc_poly_coeff, secs - _initial_time);
+  k.ti = _initial_time;
+  k.tf = _final_time;
+  k.pi = _pi;
+  k.pf = _pf;
+
+  quintic_state_kernel(k, secs, pos, vel, acc, n);
 }
 
 /*
@@ -199,9 +433,7 @@ void Quintic_Poly_Traj::updateCoefficients()
 
   if (t < 10.0 * std::numeric_limits<double>::epsilon())
   {
-    cout << TRAJ_WARN_COLOR "[Quintic_Poly_Traj] WARNING: duration is zero... "
-                            "I will fix this..." CRESET
-         << endl;
+    trajDiagnostic(TRAJ_DIAG_WARN, "[Quintic_Poly_Traj] WARNING: duration is zero... I will fix this...");
     t = QUINTIC_POLY_EPS_TIME;
   }
 
@@ -24,6 +24,8 @@
 */
 
 #include "sun_traj_lib/Rotation_Const_Axis_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+#include <algorithm>
 
 using namespace TooN;
 using namespace std;
@@ -37,18 +39,19 @@ namespace sun
 */
 Rotation_Const_Axis_Traj::Rotation_Const_Axis_Traj(const UnitQuaternion &initial_quat, const Vector<3> &axis,
                                                    const Scalar_Traj_Interface &traj_theta)
-  : Quaternion_Traj_Interface(NAN, NAN), _initial_quat(initial_quat), _axis(unit(axis)), _traj_theta(traj_theta.clone())
+  : Quaternion_Traj_Interface(NAN, NAN), _initial_quat(initial_quat), _axis(unit(axis)), _traj_theta(traj_theta)
 {
   if (norm(axis) < 10.0 * std::numeric_limits<double>::epsilon())
   {
-    cout << TRAJ_WARN_COLOR "[Rotation_Const_Axis_Traj] WARNING: axis is zero -> no rotation" CRESET << endl;
+    trajDiagnostic(TRAJ_DIAG_WARN, "[Rotation_Const_Axis_Traj] WARNING: axis is zero -> no rotation");
     _axis = Zeros;
   }
+  updateCache();
 }
 
 Rotation_Const_Axis_Traj::Rotation_Const_Axis_Traj(const UnitQuaternion &initial_quat, const UnitQuaternion &final_quat,
                                                    const Scalar_Traj_Interface &traj_theta, double &angle)
-  : Quaternion_Traj_Interface(NAN, NAN), _initial_quat(initial_quat), _traj_theta(traj_theta.clone())
+  : Quaternion_Traj_Interface(NAN, NAN), _initial_quat(initial_quat), _traj_theta(traj_theta)
 {
   UnitQuaternion Delta_Q = final_quat * inv(initial_quat);
   sun::AngVec Delta_angvec = Delta_Q.toangvec();
@@ -56,9 +59,10 @@ Rotation_Const_Axis_Traj::Rotation_Const_Axis_Traj(const UnitQuaternion &initial
   angle = Delta_angvec.getAng();
   if (norm(_axis) < 10.0 * std::numeric_limits<double>::epsilon())
   {
-    cout << TRAJ_WARN_COLOR "[Rotation_Const_Axis_Traj] WARNING: axis is zero -> no rotation" CRESET << endl;
+    trajDiagnostic(TRAJ_DIAG_WARN, "[Rotation_Const_Axis_Traj] WARNING: axis is zero -> no rotation");
     _axis = Zeros;
   }
+  updateCache();
 }
 
 Rotation_Const_Axis_Traj::Rotation_Const_Axis_Traj(const Rotation_Const_Axis_Traj &traj)
@@ -66,7 +70,21 @@ Rotation_Const_Axis_Traj::Rotation_Const_Axis_Traj(const Rotation_Const_Axis_Tra
 {
   _initial_quat = traj._initial_quat;
   _axis = traj._axis;
-  _traj_theta = Scalar_Traj_Interface_Ptr(traj._traj_theta->clone());
+  _axis_quat = traj._axis_quat;
+  _zero_axis = traj._zero_axis;
+  _traj_theta = traj._traj_theta;
+}
+
+/*
+    Copy Constructor, a non built-in angle traj is cloned in arena
+*/
+Rotation_Const_Axis_Traj::Rotation_Const_Axis_Traj(const Rotation_Const_Axis_Traj &traj, Traj_Arena &arena)
+  : Quaternion_Traj_Interface(NAN, NAN), _traj_theta(traj._traj_theta, arena)
+{
+  _initial_quat = traj._initial_quat;
+  _axis = traj._axis;
+  _axis_quat = traj._axis_quat;
+  _zero_axis = traj._zero_axis;
 }
 
 /*
@@ -77,6 +95,33 @@ Rotation_Const_Axis_Traj *Rotation_Const_Axis_Traj::clone() const
   return new Rotation_Const_Axis_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+Rotation_Const_Axis_Traj *Rotation_Const_Axis_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Rotation_Const_Axis_Traj>(*this, arena);
+}
+
+/*
+    Update the cache from _axis and _initial_quat
+    [0, axis] * Q = [-axis'*Q.v, Q.s*axis + axis x Q.v]
+*/
+void Rotation_Const_Axis_Traj::updateCache()
+{
+  _zero_axis = (_axis[0] == 0.0 && _axis[1] == 0.0 && _axis[2] == 0.0);
+  if (_zero_axis)
+  {
+    // sin(theta/2) * _axis_quat is never used
+    _axis_quat = _initial_quat;
+    return;
+  }
+  Vector<3> q_v = _initial_quat.getV();
+  Vector<3> v = _initial_quat.getS() * _axis;
+  v += _axis ^ q_v;
+  _axis_quat = UnitQuaternion(-(_axis * q_v), v);
+}
+
 /*======END CONSTRUCTORS=========*/
 
 /*====== GETTERS =========*/
@@ -102,7 +147,7 @@ UnitQuaternion Rotation_Const_Axis_Traj::getInitialQuat() const
 */
 double Rotation_Const_Axis_Traj::getFinalTime() const
 {
-  return _traj_theta->getFinalTime();
+  return _traj_theta.getFinalTime();
 }
 
 /*
@@ -110,7 +155,7 @@ double Rotation_Const_Axis_Traj::getFinalTime() const
 */
 double Rotation_Const_Axis_Traj::getInitialTime() const
 {
-  return _traj_theta->getInitialTime();
+  return _traj_theta.getInitialTime();
 }
 
 /*====== END GETTERS =========*/
@@ -125,9 +170,10 @@ void Rotation_Const_Axis_Traj::setAxis(const Vector<3> &axis)
   _axis = unit(axis);
   if (norm(axis) < 10.0 * std::numeric_limits<double>::epsilon())
   {
-    cout << TRAJ_WARN_COLOR "axis is zero -> no rotation" CRESET << endl;
+    trajDiagnostic(TRAJ_DIAG_WARN, "axis is zero -> no rotation");
     _axis = Zeros;
   }
+  updateCache();
 }
 
 /*
@@ -136,6 +182,7 @@ void Rotation_Const_Axis_Traj::setAxis(const Vector<3> &axis)
 void Rotation_Const_Axis_Traj::setInitialQuat(const UnitQuaternion &initial_quat)
 {
   _initial_quat = initial_quat;
+  updateCache();
 }
 
 /*
@@ -143,7 +190,7 @@ void Rotation_Const_Axis_Traj::setInitialQuat(const UnitQuaternion &initial_quat
 */
 void Rotation_Const_Axis_Traj::changeInitialTime(double initial_time)
 {
-  _traj_theta->changeInitialTime(initial_time);
+  _traj_theta.changeInitialTime(initial_time);
 }
 
 /*
@@ -152,7 +199,15 @@ void Rotation_Const_Axis_Traj::changeInitialTime(double initial_time)
 */
 void Rotation_Const_Axis_Traj::setScalarTraj(const Scalar_Traj_Interface &traj_theta)
 {
-  _traj_theta = Scalar_Traj_Interface_Ptr(traj_theta.clone());
+  _traj_theta = traj_theta;
+}
+
+/*
+    Set the angle trajectory taking ownership of traj_theta
+*/
+void Rotation_Const_Axis_Traj::setScalarTraj(Scalar_Traj_Interface_Ptr &&traj_theta)
+{
+  _traj_theta = std::move(traj_theta);
 }
 
 /*====== END SETTERS =========*/
@@ -179,6 +234,7 @@ void Rotation_Const_Axis_Traj::changeFrame(const UnitQuaternion &new_Q_curr)
 {
   _initial_quat = new_Q_curr * _initial_quat;
   _axis = new_Q_curr * _axis;
+  updateCache();
 }
 
 /*====== END TRANSFORM =========*/
@@ -188,14 +244,30 @@ void Rotation_Const_Axis_Traj::changeFrame(const UnitQuaternion &new_Q_curr)
 */
 UnitQuaternion Rotation_Const_Axis_Traj::getDeltaQuat(double secs) const
 {
-  if (_axis[0] == 0.0 && _axis[1] == 0.0 && _axis[2] == 0.0)
+  if (_zero_axis)
   {
     return UnitQuaternion();
   }
-  else
+  double half_theta = 0.5 * _traj_theta.getPosition(secs);
+  return UnitQuaternion(cos(half_theta), sin(half_theta) * _axis);
+}
+
+/*
+     Get Quaternion at the angle theta
+     Q(theta) = [cos(theta/2), sin(theta/2) axis] * _initial_quat
+              = cos(theta/2) * _initial_quat + sin(theta/2) * _axis_quat
+*/
+UnitQuaternion Rotation_Const_Axis_Traj::getQuaternionAtAngle(double theta) const
+{
+  if (_zero_axis)
   {
-    return UnitQuaternion::angvec(_traj_theta->getPosition(secs), _axis);
+    return _initial_quat;
   }
+  double half_theta = 0.5 * theta;
+  double c = cos(half_theta);
+  double sn = sin(half_theta);
+  return UnitQuaternion(c * _initial_quat.getS() + sn * _axis_quat.getS(),
+                        c * _initial_quat.getV() + sn * _axis_quat.getV());
 }
 
 /*
@@ -203,7 +275,7 @@ UnitQuaternion Rotation_Const_Axis_Traj::getDeltaQuat(double secs) const
 */
 UnitQuaternion Rotation_Const_Axis_Traj::getQuaternion(double secs) const
 {
-  return getDeltaQuat(secs) * _initial_quat;
+  return getQuaternionAtAngle(_traj_theta.getPosition(secs));
 }
 
 /*
@@ -211,7 +283,7 @@ UnitQuaternion Rotation_Const_Axis_Traj::getQuaternion(double secs) const
 */
 Vector<3> Rotation_Const_Axis_Traj::getVelocity(double secs) const
 {
-  return _traj_theta->getVelocity(secs) * _axis;
+  return _traj_theta.getVelocity(secs) * _axis;
 }
 
 /*
@@ -219,7 +291,57 @@ Vector<3> Rotation_Const_Axis_Traj::getVelocity(double secs) const
 */
 Vector<3> Rotation_Const_Axis_Traj::getAcceleration(double secs) const
 {
-  return _traj_theta->getAcceleration(secs) * _axis;
+  return _traj_theta.getAcceleration(secs) * _axis;
+}
+
+/*====== BATCH RUNNERS =========*/
+
+/*
+    Get Quaternion at the n angles thetas[0..n-1]
+    The result is written in out[0..n-1]
+*/
+void Rotation_Const_Axis_Traj::getQuaternionAtAngleBatch(const double *thetas, UnitQuaternion *out, int n) const
+{
+  if (_zero_axis)
+  {
+    for (int i = 0; i < n; i++)
+    {
+      out[i] = _initial_quat;
+    }
+    return;
+  }
+
+  // unpack the cache once, the loop is a sin/cos and 8 multiply-add per sample
+  const double q0_s = _initial_quat.getS();
+  const Vector<3> q0_v = _initial_quat.getV();
+  const double q1_s = _axis_quat.getS();
+  const Vector<3> q1_v = _axis_quat.getV();
+  for (int i = 0; i < n; i++)
+  {
+    double half_theta = 0.5 * thetas[i];
+    double c = cos(half_theta);
+    double sn = sin(half_theta);
+    out[i] = UnitQuaternion(c * q0_s + sn * q1_s, c * q0_v + sn * q1_v);
+  }
+}
+
+/*
+    Get Quaternion at the n time instants secs[0..n-1]
+    The result is written in out[0..n-1]
+    The angles are computed in chunks with the batch runner of the angle traj
+*/
+void Rotation_Const_Axis_Traj::getQuaternionBatch(const double *secs, UnitQuaternion *out, int n) const
+{
+  const int CHUNK = 64;
+  double thetas[CHUNK];
+  for (int i = 0; i < n; i += CHUNK)
+  {
+    int m = std::min(CHUNK, n - i);
+    _traj_theta.get().getPositionBatch(secs + i, thetas, m);
+    getQuaternionAtAngleBatch(thetas, out + i, m);
+  }
 }
 
+/*====== END BATCH RUNNERS =========*/
+
 }  // namespace sun
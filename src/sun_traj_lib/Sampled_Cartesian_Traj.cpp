@@ -0,0 +1,274 @@
+/*
+
+    Sampled Cartesian Traj Class
+    Cartesian trajectory precomputed on a uniform time grid
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Sampled_Cartesian_Traj.h"
+
+using namespace TooN;
+using namespace std;
+
+namespace sun
+{
+/*======CONSTRUCTORS=========*/
+
+/*
+    Constructor, sample traj from its initial time to its final time with period sample_period
+*/
+Sampled_Cartesian_Traj::Sampled_Cartesian_Traj(const Cartesian_Traj_Interface& traj, double sample_period,
+                                               Sampled_Traj_Interpolation interpolation)
+  : Cartesian_Traj_Interface(traj.getDuration(), traj.getInitialTime())
+  , _table(sampledTrajNumSamples(traj.getDuration(), sample_period), NUM_COLUMNS, sample_period)
+  , _interpolation(interpolation)
+{
+  _mask = traj.getMask(_initial_time);
+  int n = _table.getNumSamples();
+  double* cols[NUM_COLUMNS];
+  for (int c = 0; c < NUM_COLUMNS; c++)
+  {
+    cols[c] = _table.getMutableColumn(c);
+  }
+  for (int k = 0; k < n; k++)
+  {
+    double secs = _initial_time + k * sample_period;
+    Vector<3> p = traj.getPosition(secs);
+    UnitQuaternion q = traj.getQuaternion(secs);
+    Vector<6> twist = traj.getTwist(secs);
+
+    double q_s = q.getS();
+    Vector<3> q_v = q.getV();
+    // keep consecutive samples on the same hemisphere (q and -q are the same rotation)
+    if (k > 0)
+    {
+      double dot = q_s * cols[COL_QUATERNION][k - 1];
+      for (int i = 0; i < 3; i++)
+        dot += q_v[i] * cols[COL_QUATERNION + 1 + i][k - 1];
+      if (dot < 0.0)
+      {
+        q_s = -q_s;
+        q_v = -q_v;
+      }
+    }
+
+    cols[COL_QUATERNION][k] = q_s;
+    for (int i = 0; i < 3; i++)
+    {
+      cols[COL_POSITION + i][k] = p[i];
+      cols[COL_QUATERNION + 1 + i][k] = q_v[i];
+      cols[COL_LINEAR_VELOCITY + i][k] = twist[i];
+      cols[COL_ANGULAR_VELOCITY + i][k] = twist[3 + i];
+    }
+  }
+}
+
+/*
+    Constructor from a table with NUM_COLUMNS columns
+*/
+Sampled_Cartesian_Traj::Sampled_Cartesian_Traj(const Sampled_Traj_Table& table, double duration, double initial_time,
+                                               Sampled_Traj_Interpolation interpolation)
+  : Cartesian_Traj_Interface(duration, initial_time), _table(table), _interpolation(interpolation)
+{
+  if (_table.getNumColumns() != NUM_COLUMNS)
+  {
+    trajFatal("Error in Sampled_Cartesian_Traj() | wrong number of columns");
+    // the fatal handler returned, use a zero table
+    _table = Sampled_Traj_Table(2, NUM_COLUMNS, 1.0);
+    _table.getMutableColumn(COL_QUATERNION)[0] = 1.0;
+    _table.getMutableColumn(COL_QUATERNION)[1] = 1.0;
+  }
+}
+
+/*
+    Clone the object in the heap
+*/
+Sampled_Cartesian_Traj* Sampled_Cartesian_Traj::clone() const
+{
+  return new Sampled_Cartesian_Traj(*this);
+}
+
+/*======END CONSTRUCTORS=========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Get the table of samples
+*/
+const Sampled_Traj_Table& Sampled_Cartesian_Traj::getTable() const
+{
+  return _table;
+}
+
+/*
+    Get the interpolation method
+*/
+Sampled_Traj_Interpolation Sampled_Cartesian_Traj::getInterpolation() const
+{
+  return _interpolation;
+}
+
+/*====== END GETTERS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Set the interpolation method
+*/
+void Sampled_Cartesian_Traj::setInterpolation(Sampled_Traj_Interpolation interpolation)
+{
+  _interpolation = interpolation;
+}
+
+/*====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of the trajectory
+    Apply an homogeneous transfrmation matrix to the trajectory
+    new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+*/
+void Sampled_Cartesian_Traj::changeFrame(const Matrix<4, 4>& new_T_curr)
+{
+  Matrix<3, 3> R = new_T_curr.slice<0, 0, 3, 3>();
+  Vector<3> t = makeVector(new_T_curr(0, 3), new_T_curr(1, 3), new_T_curr(2, 3));
+  UnitQuaternion new_Q_curr(R);
+  int n = _table.getNumSamples();
+  double* cols[NUM_COLUMNS];
+  for (int c = 0; c < NUM_COLUMNS; c++)
+  {
+    cols[c] = _table.getMutableColumn(c);
+  }
+  const int vec_cols[] = { COL_POSITION, COL_LINEAR_VELOCITY, COL_ANGULAR_VELOCITY };
+  for (int k = 0; k < n; k++)
+  {
+    for (int c : vec_cols)
+    {
+      Vector<3> x = makeVector(cols[c][k], cols[c + 1][k], cols[c + 2][k]);
+      x = R * x;
+      if (c == COL_POSITION)
+        x += t;
+      cols[c][k] = x[0];
+      cols[c + 1][k] = x[1];
+      cols[c + 2][k] = x[2];
+    }
+    // The same rotation is applied to all samples, so the hemisphere continuity is preserved
+    UnitQuaternion q = new_Q_curr * UnitQuaternion(cols[COL_QUATERNION][k],
+                                                   makeVector(cols[COL_QUATERNION + 1][k], cols[COL_QUATERNION + 2][k],
+                                                              cols[COL_QUATERNION + 3][k]));
+    Vector<3> q_v = q.getV();
+    cols[COL_QUATERNION][k] = q.getS();
+    cols[COL_QUATERNION + 1][k] = q_v[0];
+    cols[COL_QUATERNION + 2][k] = q_v[1];
+    cols[COL_QUATERNION + 3][k] = q_v[2];
+  }
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Interpolate the 3 columns starting from c
+*/
+Vector<3> Sampled_Cartesian_Traj::interpolate3(int c, int dc, int k, double u) const
+{
+  Vector<3> out;
+  for (int i = 0; i < 3; i++)
+  {
+    out[i] = _table.interpolate(_interpolation, c + i, dc < 0 ? -1 : dc + i, k, u);
+  }
+  return out;
+}
+
+/*
+    Get Position at time secs
+*/
+Vector<3> Sampled_Cartesian_Traj::getPosition(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  return interpolate3(COL_POSITION, COL_LINEAR_VELOCITY, k, u);
+}
+
+/*
+    Get Quaternion at time secs
+*/
+UnitQuaternion Sampled_Cartesian_Traj::getQuaternion(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  if (_interpolation == SAMPLED_TRAJ_NEAREST)
+  {
+    int j = u < 0.5 ? k : k + 1;
+    return UnitQuaternion(_table.getColumn(COL_QUATERNION)[j],
+                          makeVector(_table.getColumn(COL_QUATERNION + 1)[j], _table.getColumn(COL_QUATERNION + 2)[j],
+                                     _table.getColumn(COL_QUATERNION + 3)[j]));
+  }
+  // normalized linear interpolation
+  double q_s = _table.linear(COL_QUATERNION, k, u);
+  Vector<3> q_v = makeVector(_table.linear(COL_QUATERNION + 1, k, u), _table.linear(COL_QUATERNION + 2, k, u),
+                             _table.linear(COL_QUATERNION + 3, k, u));
+  double q_norm = sqrt(q_s * q_s + q_v * q_v);
+  return UnitQuaternion(q_s / q_norm, q_v / q_norm);
+}
+
+/*
+    Get Linear Velocity at time secs
+*/
+Vector<3> Sampled_Cartesian_Traj::getLinearVelocity(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  return interpolate3(COL_LINEAR_VELOCITY, -1, k, u);
+}
+
+/*
+    Get Angular Velocity at time secs
+*/
+Vector<3> Sampled_Cartesian_Traj::getAngularVelocity(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  return interpolate3(COL_ANGULAR_VELOCITY, -1, k, u);
+}
+
+/*
+    Get Twist Velocity at time secs [ v , w ]^T
+*/
+Vector<6> Sampled_Cartesian_Traj::getTwist(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  Vector<6> t;
+  t.slice<0, 3>() = interpolate3(COL_LINEAR_VELOCITY, -1, k, u);
+  t.slice<3, 3>() = interpolate3(COL_ANGULAR_VELOCITY, -1, k, u);
+  return t;
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
@@ -0,0 +1,200 @@
+/*
+
+    Sampled Position Traj Class
+    Position trajectory precomputed on a uniform time grid
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Sampled_Position_Traj.h"
+
+using namespace TooN;
+using namespace std;
+
+namespace sun
+{
+/*======CONSTRUCTORS=========*/
+
+/*
+    Constructor, sample traj from its initial time to its final time with period sample_period
+*/
+Sampled_Position_Traj::Sampled_Position_Traj(const Position_Traj_Interface& traj, double sample_period,
+                                             Sampled_Traj_Interpolation interpolation)
+  : Position_Traj_Interface(traj.getDuration(), traj.getInitialTime())
+  , _table(sampledTrajNumSamples(traj.getDuration(), sample_period), NUM_COLUMNS, sample_period)
+  , _interpolation(interpolation)
+{
+  _mask = traj.getMask(_initial_time);
+  int n = _table.getNumSamples();
+  double* cols[NUM_COLUMNS];
+  for (int c = 0; c < NUM_COLUMNS; c++)
+  {
+    cols[c] = _table.getMutableColumn(c);
+  }
+  for (int k = 0; k < n; k++)
+  {
+    double secs = _initial_time + k * sample_period;
+    Vector<3> p = traj.getPosition(secs);
+    Vector<3> v = traj.getVelocity(secs);
+    Vector<3> a = traj.getAcceleration(secs);
+    for (int i = 0; i < 3; i++)
+    {
+      cols[COL_POSITION + i][k] = p[i];
+      cols[COL_VELOCITY + i][k] = v[i];
+      cols[COL_ACCELERATION + i][k] = a[i];
+    }
+  }
+}
+
+/*
+    Constructor from a table with NUM_COLUMNS columns
+*/
+Sampled_Position_Traj::Sampled_Position_Traj(const Sampled_Traj_Table& table, double duration, double initial_time,
+                                             Sampled_Traj_Interpolation interpolation)
+  : Position_Traj_Interface(duration, initial_time), _table(table), _interpolation(interpolation)
+{
+  if (_table.getNumColumns() != NUM_COLUMNS)
+  {
+    trajFatal("Error in Sampled_Position_Traj() | wrong number of columns");
+    // the fatal handler returned, use a zero table
+    _table = Sampled_Traj_Table(2, NUM_COLUMNS, 1.0);
+  }
+}
+
+/*
+    Clone the object in the heap
+*/
+Sampled_Position_Traj* Sampled_Position_Traj::clone() const
+{
+  return new Sampled_Position_Traj(*this);
+}
+
+/*======END CONSTRUCTORS=========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Get the table of samples
+*/
+const Sampled_Traj_Table& Sampled_Position_Traj::getTable() const
+{
+  return _table;
+}
+
+/*
+    Get the interpolation method
+*/
+Sampled_Traj_Interpolation Sampled_Position_Traj::getInterpolation() const
+{
+  return _interpolation;
+}
+
+/*====== END GETTERS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Set the interpolation method
+*/
+void Sampled_Position_Traj::setInterpolation(Sampled_Traj_Interpolation interpolation)
+{
+  _interpolation = interpolation;
+}
+
+/*====== END SETTERS =========*/
+
+/*====== TRANSFORM =========*/
+
+/*
+    Change the reference frame of the trajectory
+    Apply an homogeneous transfrmation matrix to the trajectory
+    new_T_curr is the homog transf matrix of the current frame w.r.t. the new frame
+*/
+void Sampled_Position_Traj::changeFrame(const Matrix<4, 4>& new_T_curr)
+{
+  Matrix<3, 3> R = new_T_curr.slice<0, 0, 3, 3>();
+  Vector<3> t = makeVector(new_T_curr(0, 3), new_T_curr(1, 3), new_T_curr(2, 3));
+  int n = _table.getNumSamples();
+  double* cols[NUM_COLUMNS];
+  for (int c = 0; c < NUM_COLUMNS; c++)
+  {
+    cols[c] = _table.getMutableColumn(c);
+  }
+  for (int k = 0; k < n; k++)
+  {
+    for (int c = COL_POSITION; c < NUM_COLUMNS; c += 3)
+    {
+      Vector<3> x = makeVector(cols[c][k], cols[c + 1][k], cols[c + 2][k]);
+      x = R * x;
+      if (c == COL_POSITION)
+        x += t;
+      cols[c][k] = x[0];
+      cols[c + 1][k] = x[1];
+      cols[c + 2][k] = x[2];
+    }
+  }
+}
+
+/*====== END TRANSFORM =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Interpolate the 3 columns starting from c
+*/
+Vector<3> Sampled_Position_Traj::interpolate3(int c, int dc, double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  Vector<3> out;
+  for (int i = 0; i < 3; i++)
+  {
+    out[i] = _table.interpolate(_interpolation, c + i, dc < 0 ? -1 : dc + i, k, u);
+  }
+  return out;
+}
+
+/*
+    Get Position at time secs
+*/
+Vector<3> Sampled_Position_Traj::getPosition(double secs) const
+{
+  return interpolate3(COL_POSITION, COL_VELOCITY, secs);
+}
+
+/*
+    Get Velocity at time secs
+*/
+Vector<3> Sampled_Position_Traj::getVelocity(double secs) const
+{
+  return interpolate3(COL_VELOCITY, COL_ACCELERATION, secs);
+}
+
+/*
+    Get Acceleration at time secs
+*/
+Vector<3> Sampled_Position_Traj::getAcceleration(double secs) const
+{
+  return interpolate3(COL_ACCELERATION, -1, secs);
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
@@ -0,0 +1,164 @@
+/*
+
+    Sampled Scalar Traj Class
+    Scalar trajectory precomputed on a uniform time grid
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Sampled_Scalar_Traj.h"
+
+using namespace std;
+
+namespace sun
+{
+/*======CONSTRUCTORS=========*/
+
+/*
+    Constructor, sample traj from its initial time to its final time with period sample_period
+*/
+Sampled_Scalar_Traj::Sampled_Scalar_Traj(const Scalar_Traj_Interface& traj, double sample_period,
+                                         Sampled_Traj_Interpolation interpolation)
+  : Scalar_Traj_Interface(traj.getDuration(), traj.getInitialTime())
+  , _table(sampledTrajNumSamples(traj.getDuration(), sample_period), NUM_COLUMNS, sample_period)
+  , _interpolation(interpolation)
+{
+  int n = _table.getNumSamples();
+  double* pos = _table.getMutableColumn(COL_POSITION);
+  double* vel = _table.getMutableColumn(COL_VELOCITY);
+  double* acc = _table.getMutableColumn(COL_ACCELERATION);
+  for (int k = 0; k < n; k++)
+  {
+    Scalar_Traj_State state = traj.getState(_initial_time + k * sample_period);
+    pos[k] = state.position;
+    vel[k] = state.velocity;
+    acc[k] = state.acceleration;
+  }
+}
+
+/*
+    Constructor from a table with NUM_COLUMNS columns
+*/
+Sampled_Scalar_Traj::Sampled_Scalar_Traj(const Sampled_Traj_Table& table, double duration, double initial_time,
+                                         Sampled_Traj_Interpolation interpolation)
+  : Scalar_Traj_Interface(duration, initial_time), _table(table), _interpolation(interpolation)
+{
+  if (_table.getNumColumns() != NUM_COLUMNS)
+  {
+    trajFatal("Error in Sampled_Scalar_Traj() | wrong number of columns");
+    // the fatal handler returned, use a zero table
+    _table = Sampled_Traj_Table(2, NUM_COLUMNS, 1.0);
+  }
+}
+
+/*
+    Clone the object in the heap
+*/
+Sampled_Scalar_Traj* Sampled_Scalar_Traj::clone() const
+{
+  return new Sampled_Scalar_Traj(*this);
+}
+
+/*======END CONSTRUCTORS=========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Get the table of samples
+*/
+const Sampled_Traj_Table& Sampled_Scalar_Traj::getTable() const
+{
+  return _table;
+}
+
+/*
+    Get the interpolation method
+*/
+Sampled_Traj_Interpolation Sampled_Scalar_Traj::getInterpolation() const
+{
+  return _interpolation;
+}
+
+/*====== END GETTERS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Set the interpolation method
+*/
+void Sampled_Scalar_Traj::setInterpolation(Sampled_Traj_Interpolation interpolation)
+{
+  _interpolation = interpolation;
+}
+
+/*====== END SETTERS =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Position at time secs
+*/
+double Sampled_Scalar_Traj::getPosition(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  return _table.interpolate(_interpolation, COL_POSITION, COL_VELOCITY, k, u);
+}
+
+/*
+    Get Velocity at time secs
+*/
+double Sampled_Scalar_Traj::getVelocity(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  return _table.interpolate(_interpolation, COL_VELOCITY, COL_ACCELERATION, k, u);
+}
+
+/*
+    Get Acceleration at time secs
+*/
+double Sampled_Scalar_Traj::getAcceleration(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  return _table.interpolate(_interpolation, COL_ACCELERATION, -1, k, u);
+}
+
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+Scalar_Traj_State Sampled_Scalar_Traj::getState(double secs) const
+{
+  int k;
+  double u;
+  _table.locate(secs - _initial_time, k, u);
+  Scalar_Traj_State state;
+  state.position = _table.interpolate(_interpolation, COL_POSITION, COL_VELOCITY, k, u);
+  state.velocity = _table.interpolate(_interpolation, COL_VELOCITY, COL_ACCELERATION, k, u);
+  state.acceleration = _table.interpolate(_interpolation, COL_ACCELERATION, -1, k, u);
+  return state;
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
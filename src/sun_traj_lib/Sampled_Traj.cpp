@@ -0,0 +1,113 @@
+/*
+
+    Sampled Traj
+    Uniform time-grid lookup table shared by the sampled trajectories
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Sampled_Traj.h"
+#include <algorithm>
+#include "sun_traj_lib/Traj_Diagnostic.h"
+
+using namespace std;
+
+namespace sun
+{
+/*======CONSTRUCTORS=========*/
+
+/*
+    Constructor, allocate a zero initialized table
+*/
+Sampled_Traj_Table::Sampled_Traj_Table(int num_samples, int num_columns, double sample_period)
+{
+  if (num_samples < 2 || num_columns < 1 || !(sample_period > 0.0))
+  {
+    trajFatal("Error in Sampled_Traj_Table() | invalid size or sample period");
+    // the fatal handler returned, build a 2-samples zero table
+    allocate(2, num_columns < 1 ? 1 : num_columns, 1.0);
+    return;
+  }
+  allocate(num_samples, num_columns, sample_period);
+}
+
+/*
+    Constructor from an external storage
+*/
+Sampled_Traj_Table::Sampled_Traj_Table(int num_samples, int num_columns, double sample_period,
+                                       shared_ptr<const double> storage)
+{
+  if (num_samples < 2 || num_columns < 1 || !(sample_period > 0.0) || !storage)
+  {
+    trajFatal("Error in Sampled_Traj_Table() | invalid size, sample period or storage");
+    // the fatal handler returned, build a 2-samples zero table
+    allocate(2, num_columns < 1 ? 1 : num_columns, 1.0);
+    return;
+  }
+  _storage = move(storage);
+  _data = _storage.get();
+  _owned = false;
+  _num_samples = num_samples;
+  _num_columns = num_columns;
+  _sample_period = sample_period;
+  _inv_sample_period = 1.0 / sample_period;
+}
+
+/*======END CONSTRUCTORS=========*/
+
+/*
+    Allocate an owned zero initialized storage
+*/
+void Sampled_Traj_Table::allocate(int num_samples, int num_columns, double sample_period)
+{
+  _storage = shared_ptr<const double>(new double[num_samples * num_columns](), default_delete<double[]>());
+  _data = _storage.get();
+  _owned = true;
+  _num_samples = num_samples;
+  _num_columns = num_columns;
+  _sample_period = sample_period;
+  _inv_sample_period = 1.0 / sample_period;
+}
+
+/*
+    Make sure that the storage is owned and not shared before writing it (copy on write)
+*/
+void Sampled_Traj_Table::makeUnique()
+{
+  if (_owned && _storage.use_count() == 1)
+    return;
+  int size = _num_samples * _num_columns;
+  double* data = new double[size];
+  copy(_data, _data + size, data);
+  _storage = shared_ptr<const double>(data, default_delete<double[]>());
+  _data = data;
+  _owned = true;
+}
+
+/*
+    Get a writable pointer to column c
+*/
+double* Sampled_Traj_Table::getMutableColumn(int c)
+{
+  makeUnique();
+  // the storage was allocated by this class as non-const
+  return const_cast<double*>(getColumn(c));
+}
+
+}  // namespace sun
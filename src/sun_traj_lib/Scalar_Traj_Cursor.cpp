@@ -0,0 +1,84 @@
+/*
+
+    Scalar Traj Cursor
+    Stateful evaluator of scalar trajs for streaming (monotonic time) queries
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Scalar_Traj_Cursor.h"
+
+namespace sun
+{
+/*====== SCALAR TRAJ INTERFACE =========*/
+
+/*
+    Create a cursor placed at time secs (default: generic cursor)
+*/
+Scalar_Traj_Cursor* Scalar_Traj_Interface::createCursor(double secs) const
+{
+  return new Scalar_Traj_Generic_Cursor(*this, secs);
+}
+
+/*====== END SCALAR TRAJ INTERFACE =========*/
+
+/*====== CURSOR =========*/
+
+/*
+    Constructor of an unpositioned cursor
+*/
+Scalar_Traj_Cursor::Scalar_Traj_Cursor() : _time(NAN)
+{
+  _state.position = NAN;
+  _state.velocity = NAN;
+  _state.acceleration = NAN;
+}
+
+/*
+    Move the cursor forward by dt
+*/
+void Scalar_Traj_Cursor::advance(double dt)
+{
+  seek(_time + dt);
+}
+
+/*====== END CURSOR =========*/
+
+/*====== GENERIC CURSOR =========*/
+
+/*
+    Constructor, the cursor is placed at time secs
+*/
+Scalar_Traj_Generic_Cursor::Scalar_Traj_Generic_Cursor(const Scalar_Traj_Interface& traj, double secs) : _traj(traj)
+{
+  seek(secs);
+}
+
+/*
+    Move the cursor to time secs
+*/
+void Scalar_Traj_Generic_Cursor::seek(double secs)
+{
+  _time = secs;
+  _state = _traj.getState(secs);
+}
+
+/*====== END GENERIC CURSOR =========*/
+
+}  // namespace sun
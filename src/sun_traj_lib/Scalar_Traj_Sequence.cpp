@@ -0,0 +1,203 @@
+/*
+
+    Scalar Traj Sequence
+    Scalar traj made of a sequence of scalar trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Scalar_Traj_Sequence.h"
+
+namespace sun
+{
+/* ====== CONSTRUCTORS =======*/
+
+/*
+    Void Constructor (empty sequence)
+*/
+Scalar_Traj_Sequence::Scalar_Traj_Sequence() : Scalar_Traj_Interface(NAN, NAN)
+{
+}
+
+/*
+    Full constructor
+*/
+Scalar_Traj_Sequence::Scalar_Traj_Sequence(const std::vector<Scalar_Traj_Interface_Ptr>& traj_vec)
+  : Scalar_Traj_Interface(NAN, NAN)
+{
+  _traj_vec.reserve(traj_vec.size());
+  for (const auto& element : traj_vec)
+  {
+    push_back_traj(*element);
+  }
+}
+
+/*
+    Copy Constructor
+*/
+Scalar_Traj_Sequence::Scalar_Traj_Sequence(const Scalar_Traj_Sequence& traj)
+  : Scalar_Traj_Interface(traj), _traj_vec(traj._traj_vec), _index(traj._index)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+}
+
+/*
+    Clone the object in the heap
+*/
+Scalar_Traj_Sequence* Scalar_Traj_Sequence::clone() const
+{
+  return new Scalar_Traj_Sequence(*this);
+}
+
+/* ====== END CONSTRUCTORS =======*/
+
+/* ====== SETTERS =========*/
+
+/*
+    Push back a trajectory in the sequence
+*/
+bool Scalar_Traj_Sequence::push_back_traj(const Scalar_Traj_Interface& traj)
+{
+  if (!_index.canPushBack(traj.getInitialTime()))
+  {
+    trajDiagnostic(TRAJ_DIAG_ERROR,
+                   "Error in Scalar_Traj_Sequence::push_back_traj() | initial time %f is before the last segment",
+                   traj.getInitialTime());
+    return false;
+  }
+  _traj_vec.push_back(Scalar_Traj_Variant(traj));
+  _index.push_back(traj.getInitialTime(), traj.getFinalTime());
+  return true;
+}
+
+/*
+    Remove last traj of the sequence
+*/
+void Scalar_Traj_Sequence::pop_back_traj()
+{
+  _traj_vec.pop_back();
+  _index.pop_back();
+}
+
+/*
+    Remove all the trajs of the sequence
+*/
+void Scalar_Traj_Sequence::clear()
+{
+  _traj_vec.clear();
+  _index.clear();
+}
+
+/*
+    Change the initial time instant (translate all the trajectories in the time)
+*/
+void Scalar_Traj_Sequence::changeInitialTime(double initial_time)
+{
+  double Delta_T = initial_time - getInitialTime();
+  for (auto& element : _traj_vec)
+  {
+    element.changeInitialTime(element.getInitialTime() + Delta_T);
+  }
+  _index.shift(Delta_T);
+}
+
+/* ====== END SETTERS =========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Number of segments
+*/
+int Scalar_Traj_Sequence::size() const
+{
+  return _traj_vec.size();
+}
+
+/*
+    Get the i-th segment
+*/
+const Scalar_Traj_Interface& Scalar_Traj_Sequence::getTraj(int i) const
+{
+  return _traj_vec[i].get();
+}
+
+/*
+    Index of the active segment at time secs
+*/
+int Scalar_Traj_Sequence::getSegmentIndex(double secs) const
+{
+  return _index.find(secs);
+}
+
+/*
+    Get the final time instant
+*/
+double Scalar_Traj_Sequence::getFinalTime() const
+{
+  return _index.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Scalar_Traj_Sequence::getInitialTime() const
+{
+  return _index.getInitialTime();
+}
+
+/*====== END GETTERS =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Position at time secs
+*/
+double Scalar_Traj_Sequence::getPosition(double secs) const
+{
+  return _traj_vec[_index.find(secs)].getPosition(secs);
+}
+
+/*
+    Get Velocity at time secs
+*/
+double Scalar_Traj_Sequence::getVelocity(double secs) const
+{
+  return _traj_vec[_index.find(secs)].getVelocity(secs);
+}
+
+/*
+    Get Acceleration at time secs
+*/
+double Scalar_Traj_Sequence::getAcceleration(double secs) const
+{
+  return _traj_vec[_index.find(secs)].getAcceleration(secs);
+}
+
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+Scalar_Traj_State Scalar_Traj_Sequence::getState(double secs) const
+{
+  return _traj_vec[_index.find(secs)].getState(secs);
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
@@ -0,0 +1,284 @@
+/*
+
+    Scalar Traj Variant Class
+    Value type storing the built-in scalar trajectories inline
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Scalar_Traj_Variant.h"
+#include <new>
+#include <typeinfo>
+
+namespace sun
+{
+/*======CONSTRUCTORS========*/
+
+/*
+    Empty Constructor
+*/
+Scalar_Traj_Variant::Scalar_Traj_Variant() : _type(EMPTY)
+{
+}
+
+/*
+    Constructor, store a copy of traj
+*/
+Scalar_Traj_Variant::Scalar_Traj_Variant(const Scalar_Traj_Interface &traj) : _type(EMPTY)
+{
+  construct(traj);
+}
+
+/*
+    Copy Constructor
+*/
+Scalar_Traj_Variant::Scalar_Traj_Variant(const Scalar_Traj_Variant &traj) : _type(EMPTY)
+{
+  if (!traj.empty())
+  {
+    construct(traj.get());
+  }
+}
+
+/*
+    Copy Constructor, a non built-in traj is cloned in arena
+*/
+Scalar_Traj_Variant::Scalar_Traj_Variant(const Scalar_Traj_Variant &traj, Traj_Arena &arena) : _type(EMPTY)
+{
+  if (traj._type == GENERIC)
+  {
+    _generic = arena.clone(*traj._generic);
+    _type = GENERIC;
+  }
+  else if (!traj.empty())
+  {
+    construct(traj.get());
+  }
+}
+
+/*
+    Move Constructor, traj becomes EMPTY
+*/
+Scalar_Traj_Variant::Scalar_Traj_Variant(Scalar_Traj_Variant &&traj) : _type(EMPTY)
+{
+  construct(std::move(traj));
+}
+
+/*
+    Constructor, take ownership of traj (null -> EMPTY)
+*/
+Scalar_Traj_Variant::Scalar_Traj_Variant(Scalar_Traj_Interface_Ptr &&traj) : _type(EMPTY)
+{
+  construct(std::move(traj));
+}
+
+Scalar_Traj_Variant::~Scalar_Traj_Variant()
+{
+  destroy();
+}
+
+Scalar_Traj_Variant &Scalar_Traj_Variant::operator=(const Scalar_Traj_Variant &traj)
+{
+  if (this != &traj)
+  {
+    destroy();
+    if (!traj.empty())
+    {
+      construct(traj.get());
+    }
+  }
+  return *this;
+}
+
+Scalar_Traj_Variant &Scalar_Traj_Variant::operator=(Scalar_Traj_Variant &&traj)
+{
+  if (this != &traj)
+  {
+    destroy();
+    construct(std::move(traj));
+  }
+  return *this;
+}
+
+Scalar_Traj_Variant &Scalar_Traj_Variant::operator=(const Scalar_Traj_Interface &traj)
+{
+  // traj could be the stored object, copy it first
+  Scalar_Traj_Variant tmp(traj);
+  *this = std::move(tmp);
+  return *this;
+}
+
+Scalar_Traj_Variant &Scalar_Traj_Variant::operator=(Scalar_Traj_Interface_Ptr &&traj)
+{
+  destroy();
+  construct(std::move(traj));
+  return *this;
+}
+
+/*
+    Construct the stored traj as a copy of traj (the variant must be EMPTY)
+*/
+void Scalar_Traj_Variant::construct(const Scalar_Traj_Interface &traj)
+{
+  const std::type_info &type = typeid(traj);
+  if (type == typeid(Quintic_Poly_Traj))
+  {
+    new (&_quintic_poly) Quintic_Poly_Traj(static_cast<const Quintic_Poly_Traj &>(traj));
+    _type = QUINTIC_POLY;
+  }
+  else if (type == typeid(Trapez_Traj))
+  {
+    new (&_trapez) Trapez_Traj(static_cast<const Trapez_Traj &>(traj));
+    _type = TRAPEZ;
+  }
+  else if (type == typeid(Trapez_Vel_Traj))
+  {
+    new (&_trapez_vel) Trapez_Vel_Traj(static_cast<const Trapez_Vel_Traj &>(traj));
+    _type = TRAPEZ_VEL;
+  }
+  else if (type == typeid(Sine_Traj))
+  {
+    new (&_sine) Sine_Traj(static_cast<const Sine_Traj &>(traj));
+    _type = SINE;
+  }
+  else
+  {
+    _generic = Scalar_Traj_Interface_Ptr(traj.clone());
+    _type = GENERIC;
+  }
+}
+
+/*
+    Move the traj stored in traj (the variant must be EMPTY), traj becomes EMPTY
+*/
+void Scalar_Traj_Variant::construct(Scalar_Traj_Variant &&traj)
+{
+  if (traj._type == GENERIC)
+  {
+    _generic = std::move(traj._generic);
+    _type = GENERIC;
+    traj._type = EMPTY;
+  }
+  else if (!traj.empty())
+  {
+    // inline types are cheap to copy
+    construct(traj.get());
+    traj.destroy();
+  }
+}
+
+/*
+    Take ownership of traj (the variant must be EMPTY), traj becomes null
+*/
+void Scalar_Traj_Variant::construct(Scalar_Traj_Interface_Ptr &&traj)
+{
+  if (!traj)
+  {
+    return;
+  }
+  const std::type_info &type = typeid(*traj);
+  if (type == typeid(Quintic_Poly_Traj) || type == typeid(Trapez_Traj) || type == typeid(Trapez_Vel_Traj) ||
+      type == typeid(Sine_Traj))
+  {
+    // built-in types are stored inline
+    construct(*traj);
+    traj.reset();
+  }
+  else
+  {
+    _generic = std::move(traj);
+    _type = GENERIC;
+  }
+}
+
+/*
+    Destroy the stored traj, the variant becomes EMPTY
+*/
+void Scalar_Traj_Variant::destroy()
+{
+  switch (_type)
+  {
+    case QUINTIC_POLY:
+      _quintic_poly.~Quintic_Poly_Traj();
+      break;
+    case TRAPEZ:
+      _trapez.~Trapez_Traj();
+      break;
+    case TRAPEZ_VEL:
+      _trapez_vel.~Trapez_Vel_Traj();
+      break;
+    case SINE:
+      _sine.~Sine_Traj();
+      break;
+    case GENERIC:
+      _generic.reset();
+      break;
+    default:
+      break;
+  }
+  _type = EMPTY;
+}
+
+/*
+    Clone the stored traj in the heap
+*/
+Scalar_Traj_Interface *Scalar_Traj_Variant::clone() const
+{
+  if (empty())
+  {
+    return nullptr;
+  }
+  return get().clone();
+}
+
+/*======END CONSTRUCTORS========*/
+
+/*====== GETTERS ========*/
+
+/*
+    Get the stored traj (the variant must not be EMPTY)
+*/
+const Scalar_Traj_Interface &Scalar_Traj_Variant::get() const
+{
+  switch (_type)
+  {
+    case QUINTIC_POLY:
+      return _quintic_poly;
+    case TRAPEZ:
+      return _trapez;
+    case TRAPEZ_VEL:
+      return _trapez_vel;
+    case SINE:
+      return _sine;
+    default:
+      return *_generic;
+  }
+}
+
+/*
+    Get the stored traj (the variant must not be EMPTY)
+*/
+Scalar_Traj_Interface &Scalar_Traj_Variant::get()
+{
+  return const_cast<Scalar_Traj_Interface &>(static_cast<const Scalar_Traj_Variant *>(this)->get());
+}
+
+/*====== END GETTERS ========*/
+
+}  // namespace sun
@@ -23,6 +23,8 @@
 */
 
 #include "sun_traj_lib/Sine_Traj.h"
+#include "sun_traj_lib/Sine_Traj_Cursor.h"
+#include "sun_traj_lib/Traj_Arena.h"
 #define _USE_MATH_DEFINES
 #include <cmath>
 
@@ -45,6 +47,19 @@ Sine_Traj::Sine_Traj(double duration, double amplitude, double frequency, double
 {
 }
 
+/*
+    Non-fatal factory, validate the inputs and return the traj or an error status
+*/
+Traj_Result<Sine_Traj> Sine_Traj::create(double duration, double amplitude, double frequency, double bias,
+                                         double phase, double initial_time)
+{
+  if (!(duration >= 0.0))
+  {
+    return TRAJ_INVALID_DURATION;
+  }
+  return Sine_Traj(duration, amplitude, frequency, bias, phase, initial_time);
+}
+
 /*
     Clone the object in the heap
 */
@@ -53,6 +68,22 @@ Sine_Traj *Sine_Traj::clone() const
   return new Sine_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+Sine_Traj *Sine_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Sine_Traj>(*this);
+}
+
+/*
+    Create in the heap a cursor placed at time secs
+*/
+Scalar_Traj_Cursor *Sine_Traj::createCursor(double secs) const
+{
+  return new Sine_Traj_Cursor(_initial_time, _final_time, _A, _pulse, _phi, _bias, secs);
+}
+
 /*=======END CONSTRUCTORS======*/
 
 /*======= GETTERS =========*/
@@ -117,4 +148,70 @@ double Sine_Traj::getAcceleration(double secs) const
   return -pow(_pulse, 2) * _A * sin(_pulse * _time + _phi);
 }
 
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+Scalar_Traj_State Sine_Traj::getState(double secs) const
+{
+  double _time = secs;
+  if (_time < _initial_time)
+  {
+    _time = _initial_time;
+  }
+  if (_time > _final_time)
+  {
+    _time = _final_time;
+  }
+  _time = _time - _initial_time;
+  double sin_arg = sin(_pulse * _time + _phi);
+  double cos_arg = cos(_pulse * _time + _phi);
+
+  Scalar_Traj_State state;
+  state.position = _A * sin_arg + _bias;
+  state.velocity = _pulse * _A * cos_arg;
+  state.acceleration = -pow(_pulse, 2) * _A * sin_arg;
+  return state;
+}
+
+/*
+    Get Position at the n time instants secs[0..n-1]
+*/
+void Sine_Traj::getPositionBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, tf = _final_time, A = _A, pulse = _pulse, phi = _phi, bias = _bias;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = ((secs[i] < ti) ? ti : ((secs[i] > tf) ? tf : secs[i])) - ti;
+    out[i] = A * sin(pulse * t + phi) + bias;
+  }
+}
+
+/*
+    Get Velocity at the n time instants secs[0..n-1]
+*/
+void Sine_Traj::getVelocityBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, tf = _final_time, pulse = _pulse, phi = _phi;
+  const double gain = _pulse * _A;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = ((secs[i] < ti) ? ti : ((secs[i] > tf) ? tf : secs[i])) - ti;
+    out[i] = gain * cos(pulse * t + phi);
+  }
+}
+
+/*
+    Get Acceleration at the n time instants secs[0..n-1]
+*/
+void Sine_Traj::getAccelerationBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, tf = _final_time, pulse = _pulse, phi = _phi;
+  const double gain = -pow(_pulse, 2) * _A;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = ((secs[i] < ti) ? ti : ((secs[i] > tf) ? tf : secs[i])) - ti;
+    out[i] = gain * sin(pulse * t + phi);
+  }
+}
+
 }  // namespace sun
@@ -0,0 +1,96 @@
+/*
+
+    Sine Traj Cursor
+    Cursor of a sinusoidal trajectory
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Sine_Traj_Cursor.h"
+
+using namespace std;
+
+namespace sun
+{
+/*
+    Constructor, the cursor is placed at time secs
+*/
+Sine_Traj_Cursor::Sine_Traj_Cursor(double initial_time, double final_time, double amplitude, double pulse,
+                                   double phase, double bias, double secs)
+  : _ti(initial_time), _tf(final_time), _A(amplitude), _pulse(pulse), _phi(phase), _bias(bias), _recurrence(false)
+{
+  seek(secs);
+}
+
+/*
+    Phase at time secs
+*/
+double Sine_Traj_Cursor::getPhase(double secs) const
+{
+  double t = ((secs < _ti) ? _ti : ((secs > _tf) ? _tf : secs)) - _ti;
+  return _pulse * t + _phi;
+}
+
+/*
+    Compute the state from _sin_cos
+*/
+void Sine_Traj_Cursor::updateState()
+{
+  double sin_arg = _sin_cos.getSin();
+  double cos_arg = _sin_cos.getCos();
+  _state.position = _A * sin_arg + _bias;
+  _state.velocity = _pulse * _A * cos_arg;
+  _state.acceleration = -(_pulse * _pulse) * _A * sin_arg;
+}
+
+/*
+    Move the cursor to time secs
+*/
+void Sine_Traj_Cursor::seek(double secs)
+{
+  _time = secs;
+  _sin_cos.reset(getPhase(secs));
+  updateState();
+}
+
+/*
+    Move the cursor forward by dt
+*/
+void Sine_Traj_Cursor::advance(double dt)
+{
+  if (!_recurrence)
+  {
+    seek(_time + dt);
+    return;
+  }
+  _time += dt;
+  _sin_cos.update(getPhase(_time));
+  updateState();
+}
+
+/*
+    Enable/disable the recurrence mode of advance()
+*/
+void Sine_Traj_Cursor::setRecurrence(bool enable, int resync_period)
+{
+  _recurrence = enable;
+  _sin_cos.setResyncPeriod(resync_period);
+}
+
+}  // namespace sun
@@ -0,0 +1,167 @@
+/*
+
+    Traj Arena
+    Monotonic buffer for allocation-free copies of trajectories
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Traj_Arena.h"
+#include "sun_traj_lib/Traj_Diagnostic.h"
+#include <atomic>
+
+using namespace std;
+
+namespace sun
+{
+/*
+    Memory of a Traj_Arena
+    refs = blocks in use + 1 while the arena is alive, the last one releases the memory
+*/
+struct Traj_Arena_Buffer
+{
+  char* data;
+  size_t capacity, used;
+  atomic<size_t> refs;
+  bool overflow;
+};
+
+/*
+    Release the buffer
+*/
+static void releaseBuffer(Traj_Arena_Buffer* buffer)
+{
+  ::operator delete(buffer->data);
+  delete buffer;
+}
+
+/*
+    Constructor, preallocate capacity bytes
+*/
+Traj_Arena::Traj_Arena(size_t capacity) : _buffer(new Traj_Arena_Buffer)
+{
+  _buffer->data = static_cast<char*>(::operator new(capacity));
+  _buffer->capacity = capacity;
+  _buffer->used = 0;
+  _buffer->refs.store(1);
+  _buffer->overflow = false;
+}
+
+/*
+    Destructor, all the trajs of the arena have to be already deleted
+*/
+Traj_Arena::~Traj_Arena()
+{
+  const size_t live_blocks = getLiveBlocks();
+  if (_buffer->refs.fetch_sub(1, memory_order_acq_rel) == 1)
+  {
+    releaseBuffer(_buffer);
+    return;
+  }
+  // the trajs still in use keep the buffer, the last deallocation releases it
+  trajFatal("Error in ~Traj_Arena(): %zu blocks are still in use", live_blocks);
+}
+
+/*
+    Reuse the whole buffer
+*/
+bool Traj_Arena::reset()
+{
+  const size_t live_blocks = getLiveBlocks();
+  if (live_blocks > 0)
+  {
+    trajDiagnostic(TRAJ_DIAG_ERROR, "Error in Traj_Arena::reset(): %zu blocks are still in use", live_blocks);
+    return false;
+  }
+  _buffer->used = 0;
+  _buffer->overflow = false;
+  return true;
+}
+
+/*====== GETTERS =========*/
+
+size_t Traj_Arena::getCapacity() const
+{
+  return _buffer->capacity;
+}
+
+size_t Traj_Arena::getUsed() const
+{
+  return _buffer->used;
+}
+
+size_t Traj_Arena::getLiveBlocks() const
+{
+  return _buffer->refs.load(memory_order_acquire) - 1;
+}
+
+/*====== END GETTERS =========*/
+
+/*====== ALLOCATION =========*/
+
+/*
+    Allocate size bytes from buffer (from the heap if buffer is null or full)
+*/
+void* Traj_Arena::allocate(Traj_Arena_Buffer* buffer, size_t size)
+{
+  if (buffer)
+  {
+    const size_t align = alignof(max_align_t);
+    const size_t block_size = (size + align - 1) / align * align;
+    if (block_size <= buffer->capacity - buffer->used)
+    {
+      void* p = buffer->data + buffer->used;
+      buffer->used += block_size;
+      buffer->refs.fetch_add(1, memory_order_relaxed);
+      return p;
+    }
+    if (!buffer->overflow)
+    {
+      trajDiagnostic(TRAJ_DIAG_WARN, "Warning in Traj_Arena: buffer full (%zu bytes), allocating in the heap",
+                     buffer->capacity);
+      buffer->overflow = true;
+    }
+  }
+  return ::operator new(size);
+}
+
+/*
+    Deallocate a block returned by allocate()
+*/
+void Traj_Arena::deallocate(Traj_Arena_Buffer* buffer, void* p)
+{
+  if (!p)
+    return;
+  char* block = static_cast<char*>(p);
+  if (!buffer || block < buffer->data || block >= buffer->data + buffer->capacity)
+  {
+    // heap block
+    ::operator delete(p);
+    return;
+  }
+  if (buffer->refs.fetch_sub(1, memory_order_acq_rel) == 1)
+  {
+    // last block of a destroyed arena
+    releaseBuffer(buffer);
+  }
+}
+
+/*====== END ALLOCATION =========*/
+
+}  // namespace sun
@@ -0,0 +1,332 @@
+/*
+
+    Traj Cache File
+    Binary file format to store sampled trajectories and read them back with mmap (zero copy)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Traj_Cache_File.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+
+namespace sun
+{
+/*
+    Print an error related to file_name
+*/
+static void trajCacheError(const string& file_name, const char* msg)
+{
+  trajDiagnostic(TRAJ_DIAG_ERROR, "Error in Traj_Cache_File | %s: %s", file_name.c_str(), msg);
+}
+
+/*
+    Check the fields of the header, file_size is the size of the whole file
+*/
+static bool checkTrajCacheHeader(const string& file_name, const Traj_Cache_Header& header, uint64_t file_size)
+{
+  if (strncmp(header.magic, TRAJ_CACHE_MAGIC, sizeof(header.magic)) != 0)
+  {
+    trajCacheError(file_name, "not a traj cache file");
+    return false;
+  }
+  if (header.version != TRAJ_CACHE_VERSION)
+  {
+    trajCacheError(file_name, "unsupported version");
+    return false;
+  }
+  if (header.byte_order != TRAJ_CACHE_BYTE_ORDER)
+  {
+    trajCacheError(file_name, "wrong byte order");
+    return false;
+  }
+  uint64_t num_columns;
+  switch (header.type)
+  {
+    case TRAJ_CACHE_SCALAR:
+      num_columns = Sampled_Scalar_Traj::NUM_COLUMNS;
+      break;
+    case TRAJ_CACHE_POSITION:
+      num_columns = Sampled_Position_Traj::NUM_COLUMNS;
+      break;
+    case TRAJ_CACHE_CARTESIAN:
+      num_columns = Sampled_Cartesian_Traj::NUM_COLUMNS;
+      break;
+    default:
+      trajCacheError(file_name, "unknown traj type");
+      return false;
+  }
+  if (header.num_columns != num_columns || header.num_samples < 2 || header.num_samples > INT32_MAX / num_columns ||
+      !(header.sample_period > 0.0) || !(header.duration >= 0.0) || header.interpolation > SAMPLED_TRAJ_CUBIC)
+  {
+    trajCacheError(file_name, "corrupted header");
+    return false;
+  }
+  if (file_size < TRAJ_CACHE_HEADER_SIZE + header.num_samples * header.num_columns * sizeof(double))
+  {
+    trajCacheError(file_name, "truncated file");
+    return false;
+  }
+  return true;
+}
+
+/*
+    Write header and table in file_name
+*/
+static bool writeTrajCacheTable(const string& file_name, Traj_Cache_Type type, const Traj_Generator_Interface& traj,
+                                const Sampled_Traj_Table& table, Sampled_Traj_Interpolation interpolation,
+                                const int32_t mask[6])
+{
+  char header_buffer[TRAJ_CACHE_HEADER_SIZE] = { 0 };
+  Traj_Cache_Header header;
+  memset(&header, 0, sizeof(header));
+  strncpy(header.magic, TRAJ_CACHE_MAGIC, sizeof(header.magic));
+  header.version = TRAJ_CACHE_VERSION;
+  header.byte_order = TRAJ_CACHE_BYTE_ORDER;
+  header.type = type;
+  header.interpolation = interpolation;
+  header.num_samples = table.getNumSamples();
+  header.num_columns = table.getNumColumns();
+  header.initial_time = traj.getInitialTime();
+  header.duration = traj.getDuration();
+  header.sample_period = table.getSamplePeriod();
+  for (int i = 0; i < 6; i++)
+  {
+    header.mask[i] = mask[i];
+  }
+  memcpy(header_buffer, &header, sizeof(header));
+
+  ofstream file(file_name, ios::out | ios::binary | ios::trunc);
+  if (!file)
+  {
+    trajCacheError(file_name, "unable to open the file for writing");
+    return false;
+  }
+  file.write(header_buffer, TRAJ_CACHE_HEADER_SIZE);
+  for (int c = 0; c < table.getNumColumns(); c++)
+  {
+    file.write(reinterpret_cast<const char*>(table.getColumn(c)), table.getNumSamples() * sizeof(double));
+  }
+  file.close();
+  if (!file)
+  {
+    trajCacheError(file_name, "write failed");
+    return false;
+  }
+  return true;
+}
+
+/*
+    Sample traj on a grid with period sample_period and write it in file_name
+*/
+bool writeTrajCache(const string& file_name, const Traj_Generator_Interface& traj, double sample_period,
+                    Sampled_Traj_Interpolation interpolation)
+{
+  if (!(sample_period > 0.0) || sampledTrajNumSamples(traj.getDuration(), sample_period) == 0)
+  {
+    trajCacheError(file_name, "the traj can not be sampled (invalid sample period or infinite duration)");
+    return false;
+  }
+
+  int32_t mask[6] = { 1, 1, 1, 1, 1, 1 };
+
+  if (const Scalar_Traj_Interface* scalar_traj = dynamic_cast<const Scalar_Traj_Interface*>(&traj))
+  {
+    const Sampled_Scalar_Traj* sampled = dynamic_cast<const Sampled_Scalar_Traj*>(scalar_traj);
+    if (sampled && sampled->getTable().getSamplePeriod() == sample_period)
+      return writeTrajCacheTable(file_name, TRAJ_CACHE_SCALAR, traj, sampled->getTable(), interpolation, mask);
+    Sampled_Scalar_Traj resampled(*scalar_traj, sample_period, interpolation);
+    return writeTrajCacheTable(file_name, TRAJ_CACHE_SCALAR, traj, resampled.getTable(), interpolation, mask);
+  }
+
+  if (const Position_Traj_Interface* pos_traj = dynamic_cast<const Position_Traj_Interface*>(&traj))
+  {
+    TooN::Vector<3, int> pos_mask = pos_traj->getMask(pos_traj->getInitialTime());
+    for (int i = 0; i < 3; i++)
+      mask[i] = pos_mask[i];
+    const Sampled_Position_Traj* sampled = dynamic_cast<const Sampled_Position_Traj*>(pos_traj);
+    if (sampled && sampled->getTable().getSamplePeriod() == sample_period)
+      return writeTrajCacheTable(file_name, TRAJ_CACHE_POSITION, traj, sampled->getTable(), interpolation, mask);
+    Sampled_Position_Traj resampled(*pos_traj, sample_period, interpolation);
+    return writeTrajCacheTable(file_name, TRAJ_CACHE_POSITION, traj, resampled.getTable(), interpolation, mask);
+  }
+
+  if (const Cartesian_Traj_Interface* cart_traj = dynamic_cast<const Cartesian_Traj_Interface*>(&traj))
+  {
+    TooN::Vector<6, int> cart_mask = cart_traj->getMask(cart_traj->getInitialTime());
+    for (int i = 0; i < 6; i++)
+      mask[i] = cart_mask[i];
+    const Sampled_Cartesian_Traj* sampled = dynamic_cast<const Sampled_Cartesian_Traj*>(cart_traj);
+    if (sampled && sampled->getTable().getSamplePeriod() == sample_period)
+      return writeTrajCacheTable(file_name, TRAJ_CACHE_CARTESIAN, traj, sampled->getTable(), interpolation, mask);
+    Sampled_Cartesian_Traj resampled(*cart_traj, sample_period, interpolation);
+    return writeTrajCacheTable(file_name, TRAJ_CACHE_CARTESIAN, traj, resampled.getTable(), interpolation, mask);
+  }
+
+  trajCacheError(file_name, "unsupported traj type (scalar, position or cartesian traj expected)");
+  return false;
+}
+
+/*
+    Read the header of file_name
+*/
+bool readTrajCacheHeader(const string& file_name, Traj_Cache_Header& header)
+{
+  ifstream file(file_name, ios::in | ios::binary | ios::ate);
+  if (!file)
+  {
+    trajCacheError(file_name, "unable to open the file");
+    return false;
+  }
+  uint64_t file_size = file.tellg();
+  if (file_size < TRAJ_CACHE_HEADER_SIZE)
+  {
+    trajCacheError(file_name, "truncated file");
+    return false;
+  }
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!file)
+  {
+    trajCacheError(file_name, "read failed");
+    return false;
+  }
+  return checkTrajCacheHeader(file_name, header, file_size);
+}
+
+/*
+    Map file_name in memory and return the corresponding Sampled_*_Traj
+*/
+Traj_Generator_Interface_Ptr mapTrajCache(const string& file_name)
+{
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    trajCacheError(file_name, "unable to open the file");
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size < TRAJ_CACHE_HEADER_SIZE)
+  {
+    close(fd);
+    trajCacheError(file_name, "truncated file");
+    return nullptr;
+  }
+  size_t map_size = file_stat.st_size;
+  void* map_base = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // the mapping stays valid
+  if (map_base == MAP_FAILED)
+  {
+    trajCacheError(file_name, "mmap failed");
+    return nullptr;
+  }
+
+  Traj_Cache_Header header;
+  memcpy(&header, map_base, sizeof(header));
+  if (!checkTrajCacheHeader(file_name, header, map_size))
+  {
+    munmap(map_base, map_size);
+    return nullptr;
+  }
+
+  // The storage owns the mapping: munmap when the last table referring to it is destroyed
+  const double* data = reinterpret_cast<const double*>(static_cast<const char*>(map_base) + TRAJ_CACHE_HEADER_SIZE);
+  shared_ptr<const double> storage(data, [map_base, map_size](const double*) { munmap(map_base, map_size); });
+  Sampled_Traj_Table table(header.num_samples, header.num_columns, header.sample_period, storage);
+  Sampled_Traj_Interpolation interpolation = static_cast<Sampled_Traj_Interpolation>(header.interpolation);
+
+  switch (header.type)
+  {
+    case TRAJ_CACHE_SCALAR:
+    {
+      return Traj_Generator_Interface_Ptr(
+          new Sampled_Scalar_Traj(table, header.duration, header.initial_time, interpolation));
+    }
+    case TRAJ_CACHE_POSITION:
+    {
+      Sampled_Position_Traj* traj = new Sampled_Position_Traj(table, header.duration, header.initial_time, interpolation);
+      TooN::Vector<3, int> mask;
+      for (int i = 0; i < 3; i++)
+        mask[i] = header.mask[i];
+      traj->setMask(mask);
+      return Traj_Generator_Interface_Ptr(traj);
+    }
+    default:  // TRAJ_CACHE_CARTESIAN
+    {
+      Sampled_Cartesian_Traj* traj =
+          new Sampled_Cartesian_Traj(table, header.duration, header.initial_time, interpolation);
+      TooN::Vector<6, int> mask;
+      for (int i = 0; i < 6; i++)
+        mask[i] = header.mask[i];
+      traj->setMask(mask);
+      return Traj_Generator_Interface_Ptr(traj);
+    }
+  }
+}
+
+/*
+    Cast the result of mapTrajCache to the type T
+*/
+template <class T>
+static std::unique_ptr<T> mapTypedTrajCache(const string& file_name)
+{
+  Traj_Generator_Interface_Ptr traj = mapTrajCache(file_name);
+  if (!traj)
+    return nullptr;
+  T* typed_traj = dynamic_cast<T*>(traj.get());
+  if (!typed_traj)
+  {
+    trajCacheError(file_name, "the file stores another type of traj");
+    return nullptr;
+  }
+  traj.release();
+  return std::unique_ptr<T>(typed_traj);
+}
+
+/*
+    Map a cache file storing a scalar traj
+*/
+Sampled_Scalar_Traj_Ptr mapScalarTrajCache(const string& file_name)
+{
+  return mapTypedTrajCache<Sampled_Scalar_Traj>(file_name);
+}
+
+/*
+    Map a cache file storing a position traj
+*/
+Sampled_Position_Traj_Ptr mapPositionTrajCache(const string& file_name)
+{
+  return mapTypedTrajCache<Sampled_Position_Traj>(file_name);
+}
+
+/*
+    Map a cache file storing a cartesian traj
+*/
+Sampled_Cartesian_Traj_Ptr mapCartesianTrajCache(const string& file_name)
+{
+  return mapTypedTrajCache<Sampled_Cartesian_Traj>(file_name);
+}
+
+}  // namespace sun
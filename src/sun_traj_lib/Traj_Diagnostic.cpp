@@ -0,0 +1,189 @@
+/*
+
+    Traj Diagnostic
+    Pluggable, real-time safe reporting of warnings and errors of the library
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Traj_Diagnostic.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+namespace sun
+{
+/*====== CONSOLE SINK =========*/
+
+void Traj_Console_Sink::write(Traj_Diagnostic_Level level, const char* msg)
+{
+  switch (level)
+  {
+    case TRAJ_DIAG_INFO:
+      printf("%s\n", msg);
+      break;
+    case TRAJ_DIAG_WARN:
+      printf(TRAJ_WARN_COLOR "%s" CRESET "\n", msg);
+      break;
+    default:
+      printf(TRAJ_ERROR_COLOR "%s" CRESET "\n", msg);
+      break;
+  }
+  fflush(stdout);
+}
+
+/*====== END CONSOLE SINK =========*/
+
+/*====== RING BUFFER SINK =========*/
+
+/*
+    Constructor, preallocate capacity messages
+*/
+Traj_Ring_Buffer_Sink::Traj_Ring_Buffer_Sink(size_t capacity)
+  : _buffer(new Traj_Diagnostic_Message[capacity + 1]), _capacity(capacity + 1), _head(0), _tail(0), _dropped(0)
+{
+  // one slot is always left empty to distinguish full from empty
+}
+
+/*
+    Producer side, store the message (dropped if the buffer is full)
+*/
+void Traj_Ring_Buffer_Sink::write(Traj_Diagnostic_Level level, const char* msg)
+{
+  size_t tail = _tail.load(memory_order_relaxed);
+  size_t next = tail + 1 == _capacity ? 0 : tail + 1;
+  if (next == _head.load(memory_order_acquire))
+  {
+    _dropped.fetch_add(1, memory_order_relaxed);
+    return;
+  }
+  Traj_Diagnostic_Message& slot = _buffer[tail];
+  slot.level = level;
+  strncpy(slot.text, msg, TRAJ_DIAGNOSTIC_MSG_SIZE - 1);
+  slot.text[TRAJ_DIAGNOSTIC_MSG_SIZE - 1] = '\0';
+  _tail.store(next, memory_order_release);
+}
+
+/*
+    Consumer side, pop the oldest message
+*/
+bool Traj_Ring_Buffer_Sink::pop(Traj_Diagnostic_Message& msg)
+{
+  size_t head = _head.load(memory_order_relaxed);
+  if (head == _tail.load(memory_order_acquire))
+    return false;
+  msg = _buffer[head];
+  _head.store(head + 1 == _capacity ? 0 : head + 1, memory_order_release);
+  return true;
+}
+
+/*
+    Consumer side, forward all the stored messages to sink
+*/
+size_t Traj_Ring_Buffer_Sink::drain(Traj_Diagnostic_Sink& sink)
+{
+  size_t count = 0;
+  Traj_Diagnostic_Message msg;
+  while (pop(msg))
+  {
+    sink.write(msg.level, msg.text);
+    count++;
+  }
+  return count;
+}
+
+/*
+    Number of messages dropped because the buffer was full
+*/
+size_t Traj_Ring_Buffer_Sink::getDroppedCount() const
+{
+  return _dropped.load(memory_order_relaxed);
+}
+
+/*====== END RING BUFFER SINK =========*/
+
+/*====== GLOBAL STATE =========*/
+
+static Traj_Console_Sink g_console_sink;
+static atomic<Traj_Diagnostic_Sink*> g_sink(&g_console_sink);
+
+static void defaultFatalHandler(const char* /*msg*/)
+{
+  exit(-1);
+}
+
+static atomic<Traj_Fatal_Handler> g_fatal_handler(&defaultFatalHandler);
+
+/*
+    Set the sink of the diagnostic messages
+*/
+void setTrajDiagnosticSink(Traj_Diagnostic_Sink* sink)
+{
+  g_sink.store(sink ? sink : &g_console_sink, memory_order_release);
+}
+
+/*
+    Get the current diagnostic sink
+*/
+Traj_Diagnostic_Sink* getTrajDiagnosticSink()
+{
+  return g_sink.load(memory_order_acquire);
+}
+
+/*
+    Set the fatal handler
+*/
+void setTrajFatalHandler(Traj_Fatal_Handler handler)
+{
+  g_fatal_handler.store(handler ? handler : &defaultFatalHandler, memory_order_release);
+}
+
+/*====== END GLOBAL STATE =========*/
+
+/*
+    Send a printf-style message to the current sink
+*/
+void trajDiagnostic(Traj_Diagnostic_Level level, const char* format, ...)
+{
+  char msg[TRAJ_DIAGNOSTIC_MSG_SIZE];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(msg, sizeof(msg), format, args);
+  va_end(args);
+  getTrajDiagnosticSink()->write(level, msg);
+}
+
+/*
+    Send a TRAJ_DIAG_FATAL printf-style message to the current sink, then call the fatal handler
+*/
+void trajFatal(const char* format, ...)
+{
+  char msg[TRAJ_DIAGNOSTIC_MSG_SIZE];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(msg, sizeof(msg), format, args);
+  va_end(args);
+  getTrajDiagnosticSink()->write(TRAJ_DIAG_FATAL, msg);
+  g_fatal_handler.load(memory_order_acquire)(msg);
+}
+
+}  // namespace sun
@@ -0,0 +1,134 @@
+/*
+
+    Traj Sequence Index
+    Time index of a sequence of trajs with O(log n) segment lookup
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Traj_Sequence_Index.h"
+
+using namespace std;
+
+namespace sun
+{
+/*====== CONSTRUCTORS =========*/
+
+/*
+    Void Constructor (empty index)
+*/
+Traj_Sequence_Index::Traj_Sequence_Index() : _hint(0)
+{
+}
+
+/*
+    Copy Constructor
+*/
+Traj_Sequence_Index::Traj_Sequence_Index(const Traj_Sequence_Index& index)
+  : _initial_times(index._initial_times), _final_times(index._final_times), _hint(0)
+{
+}
+
+Traj_Sequence_Index& Traj_Sequence_Index::operator=(const Traj_Sequence_Index& index)
+{
+  _initial_times = index._initial_times;
+  _final_times = index._final_times;
+  _hint.store(0, memory_order_relaxed);
+  return *this;
+}
+
+/*====== END CONSTRUCTORS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    return true if a segment starting at initial_time can be appended
+*/
+bool Traj_Sequence_Index::canPushBack(double initial_time) const
+{
+  if (isnan(initial_time))
+    return false;
+  return _initial_times.empty() || initial_time >= _initial_times.back();
+}
+
+/*
+    Append a segment
+*/
+void Traj_Sequence_Index::push_back(double initial_time, double final_time)
+{
+  _initial_times.push_back(initial_time);
+  if (!_final_times.empty() && _final_times.back() > final_time)
+    final_time = _final_times.back();
+  _final_times.push_back(final_time);
+}
+
+/*
+    Remove the last segment
+*/
+void Traj_Sequence_Index::pop_back()
+{
+  _initial_times.pop_back();
+  _final_times.pop_back();
+  _hint.store(0, memory_order_relaxed);
+}
+
+/*
+    Remove all the segments
+*/
+void Traj_Sequence_Index::clear()
+{
+  _initial_times.clear();
+  _final_times.clear();
+  _hint.store(0, memory_order_relaxed);
+}
+
+/*
+    Translate all the segments in the time by delta_time
+*/
+void Traj_Sequence_Index::shift(double delta_time)
+{
+  for (auto& t : _initial_times)
+    t += delta_time;
+  for (auto& t : _final_times)
+    t += delta_time;
+}
+
+/*====== END SETTERS =========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Initial time of the sequence (NAN if empty)
+*/
+double Traj_Sequence_Index::getInitialTime() const
+{
+  return _initial_times.empty() ? NAN : _initial_times.front();
+}
+
+/*
+    Final time of the sequence (NAN if empty)
+*/
+double Traj_Sequence_Index::getFinalTime() const
+{
+  return _final_times.empty() ? NAN : _final_times.back();
+}
+
+/*====== END GETTERS =========*/
+
+}  // namespace sun
@@ -0,0 +1,167 @@
+/*
+
+    Traj Thread Pool
+    Pool of threads running parallel loops with work stealing
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Traj_Thread_Pool.h"
+
+using namespace std;
+
+namespace sun
+{
+/*
+    Constructor, num_threads = 0 -> std::thread::hardware_concurrency()
+*/
+Traj_Thread_Pool::Traj_Thread_Pool(unsigned int num_threads)
+  : _num_threads(resolveNumThreads(num_threads))
+  , _ranges(_num_threads)
+  , _task(nullptr)
+  , _context(nullptr)
+  , _grain(1)
+  , _generation(0)
+  , _running_workers(0)
+  , _stop(false)
+{
+  for (unsigned int i = 0; i < _num_threads; i++)
+  {
+    _ranges[i].next = 0;
+    _ranges[i].end = 0;
+  }
+  // thread 0 is the caller of parallelFor
+  _workers.reserve(_num_threads - 1);
+  for (unsigned int i = 1; i < _num_threads; i++)
+  {
+    _workers.emplace_back(&Traj_Thread_Pool::workerLoop, this, i);
+  }
+}
+
+Traj_Thread_Pool::~Traj_Thread_Pool()
+{
+  {
+    lock_guard<mutex> lock(_mutex);
+    _stop = true;
+  }
+  _start_cv.notify_all();
+  for (auto& worker : _workers)
+  {
+    worker.join();
+  }
+}
+
+/*
+    num_threads, or std::thread::hardware_concurrency() if num_threads = 0
+*/
+unsigned int Traj_Thread_Pool::resolveNumThreads(unsigned int num_threads)
+{
+  if (num_threads == 0)
+    num_threads = thread::hardware_concurrency();
+  return num_threads > 0 ? num_threads : 1;
+}
+
+/*
+    Run task(context, begin, end) over [0, n) in chunks of at most grain indexes, return when all are done
+*/
+void Traj_Thread_Pool::parallelFor(size_t n, Task task, void* context, size_t grain)
+{
+  if (n == 0)
+    return;
+
+  lock_guard<mutex> call_lock(_call_mutex);
+
+  _task = task;
+  _context = context;
+  _grain = grain > 0 ? grain : 1;
+
+  // split [0, n) in one range per thread
+  for (unsigned int i = 0; i < _num_threads; i++)
+  {
+    _ranges[i].next.store(n * i / _num_threads, memory_order_relaxed);
+    _ranges[i].end = n * (i + 1) / _num_threads;
+  }
+
+  if (_num_threads > 1)
+  {
+    {
+      lock_guard<mutex> lock(_mutex);
+      _running_workers = _num_threads - 1;
+      _generation++;
+    }
+    _start_cv.notify_all();
+  }
+
+  work(0);
+
+  if (_num_threads > 1)
+  {
+    unique_lock<mutex> lock(_mutex);
+    _done_cv.wait(lock, [this] { return _running_workers == 0; });
+  }
+}
+
+/*
+    Main loop of the worker thread id
+*/
+void Traj_Thread_Pool::workerLoop(unsigned int id)
+{
+  unsigned long generation = 0;
+  while (true)
+  {
+    {
+      unique_lock<mutex> lock(_mutex);
+      _start_cv.wait(lock, [this, generation] { return _stop || _generation != generation; });
+      if (_stop)
+        return;
+      generation = _generation;
+    }
+
+    work(id);
+
+    bool last;
+    {
+      lock_guard<mutex> lock(_mutex);
+      last = (--_running_workers == 0);
+    }
+    if (last)
+      _done_cv.notify_one();
+  }
+}
+
+/*
+    Run the current loop as thread id: own range first, then steal from the others
+*/
+void Traj_Thread_Pool::work(unsigned int id)
+{
+  for (unsigned int k = 0; k < _num_threads; k++)
+  {
+    Range& range = _ranges[(id + k) % _num_threads];
+    while (true)
+    {
+      size_t begin = range.next.fetch_add(_grain, memory_order_relaxed);
+      if (begin >= range.end)
+        break;
+      size_t end = begin + _grain < range.end ? begin + _grain : range.end;
+      _task(_context, begin, end);
+    }
+  }
+}
+
+}  // namespace sun
@@ -23,6 +23,8 @@
 */
 
 #include "sun_traj_lib/Trapez_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+#include "sun_traj_lib/Trapez_Traj_Cursor.h"
 
 using namespace std;
 
@@ -30,15 +32,15 @@ namespace sun
 {
 /*=======CONSTRUCTORS======*/
 
+/*
+    return true if cruise_speed is feasible for the given displacement and duration
+*/
 bool Trapez_Traj::checkTrapez(double duration, double initial_position, double final_position, double cruise_speed)
 {
   if (((fabs(final_position - initial_position) / duration) >= fabs(cruise_speed)) ||
       (fabs(cruise_speed) > (2.0 * (fabs(final_position - initial_position) / duration))) ||
       (((final_position - initial_position) * cruise_speed) < 0.0))
   {
-    cout << fabs(final_position - initial_position) / duration << endl;
-    cout << fabs(cruise_speed) << endl;
-    cout << (2.0 * (fabs(final_position - initial_position) / duration)) << endl;
     return false;
   }
   return true;
@@ -57,17 +59,14 @@ Trapez_Traj::Trapez_Traj(double duration, double initial_position, double final_
   }
   else{
     _no_traj = false;
-    if (((fabs(_pf - _pi) / getDuration()) >= fabs(cruise_speed)) ||
-        (fabs(cruise_speed) > (2.0 * (fabs(_pf - _pi) / getDuration()))) || (((_pf - _pi) * cruise_speed) < 0.0))
+    if (!checkTrapez(getDuration(), _pi, _pf, cruise_speed))
     {
-      cout << _pf << endl;
-      cout << _pi << endl;
-      cout << getDuration() << endl;
-      cout << fabs(_pf - _pi) / getDuration() << endl;
-      cout << cruise_speed << endl;
-      cout << (2.0 * (fabs(_pf - _pi) / getDuration())) << endl;
-      cout << TRAJ_ERROR_COLOR "ERROR in Trapez_Traj()" CRESET << endl;
-      exit(-1);
+      trajFatal("ERROR in Trapez_Traj() | pi=%g pf=%g duration=%g: cruise_speed=%g has to be in (%g, %g]", _pi, _pf,
+                getDuration(), cruise_speed, fabs(_pf - _pi) / getDuration(),
+                2.0 * (fabs(_pf - _pi) / getDuration()));
+      // the fatal handler returned, hold the initial position
+      _pf = _pi;
+      _no_traj = true;
     }
   }
 
@@ -76,6 +75,23 @@ Trapez_Traj::Trapez_Traj(double duration, double initial_position, double final_
   _ddp = cruise_speed / _tc;
 }
 
+/*
+    Non-fatal factory, validate the inputs and return the traj or an error status
+*/
+Traj_Result<Trapez_Traj> Trapez_Traj::create(double duration, double initial_position, double final_position,
+                                             double cruise_speed, double initial_time)
+{
+  if (!(duration >= 0.0))
+  {
+    return TRAJ_INVALID_DURATION;
+  }
+  if (final_position != initial_position && !checkTrapez(duration, initial_position, final_position, cruise_speed))
+  {
+    return TRAJ_INVALID_CRUISE_SPEED;
+  }
+  return Trapez_Traj(duration, initial_position, final_position, cruise_speed, initial_time);
+}
+
 /*
     Clone the object in the heap
 */
@@ -84,6 +100,26 @@ Trapez_Traj *Trapez_Traj::clone() const
   return new Trapez_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+Trapez_Traj *Trapez_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Trapez_Traj>(*this);
+}
+
+/*
+    Create in the heap a cursor placed at time secs
+*/
+Scalar_Traj_Cursor *Trapez_Traj::createCursor(double secs) const
+{
+  if (_no_traj)
+  {
+    return new Trapez_Traj_Cursor(_initial_time, _pi, _pi, 0.0, 0.0, getDuration(), secs);
+  }
+  return new Trapez_Traj_Cursor(_initial_time, _pi, _pf, _ddp, _tc, getDuration(), secs);
+}
+
 /*=======END CONSTRUCTORS======*/
 
 /*======= GETTERS =========*/
@@ -193,4 +229,142 @@ double Trapez_Traj::getAcceleration(double secs) const
   }
 }
 
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+Scalar_Traj_State Trapez_Traj::getState(double secs) const
+{
+  Scalar_Traj_State state;
+  state.position = _pi;
+  state.velocity = 0.0;
+  state.acceleration = 0.0;
+
+  if (_no_traj)
+  {
+    return state;
+  }
+
+  double t = secs - _initial_time;
+  double duration = getDuration();
+  if (t < 0.0)
+  {
+    return state;
+  }
+  if (t <= _tc)
+  {
+    state.position = _pi + 0.5 * _ddp * pow(t, 2);
+    state.velocity = _ddp * t;
+    state.acceleration = _ddp;
+    return state;
+  }
+  if (t <= (duration - _tc))
+  {
+    state.position = _pi + _ddp * _tc * (t - (_tc / 2.0));
+    state.velocity = _ddp * _tc;
+    return state;
+  }
+  if (t <= duration)
+  {
+    state.position = _pf - 0.5 * _ddp * pow(duration - t, 2);
+    state.velocity = _ddp * (duration - t);
+    state.acceleration = -_ddp;
+    return state;
+  }
+  state.position = _pf;
+  return state;
+}
+
+/*
+    Get Position at the n time instants secs[0..n-1]
+*/
+void Trapez_Traj::getPositionBatch(const double *secs, double *out, int n) const
+{
+  if (_no_traj)
+  {
+    for (int i = 0; i < n; i++)
+      out[i] = _pi;
+    return;
+  }
+
+  const double ti = _initial_time, pi = _pi, pf = _pf, tc = _tc, ddp = _ddp;
+  const double duration = getDuration();
+  const double t_dec = duration - tc;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = secs[i] - ti;
+    if (t < 0.0)
+      out[i] = pi;
+    else if (t <= tc)
+      out[i] = pi + 0.5 * ddp * (t * t);
+    else if (t <= t_dec)
+      out[i] = pi + ddp * tc * (t - (tc / 2.0));
+    else if (t <= duration)
+      out[i] = pf - 0.5 * ddp * ((duration - t) * (duration - t));
+    else
+      out[i] = pf;
+  }
+}
+
+/*
+    Get Velocity at the n time instants secs[0..n-1]
+*/
+void Trapez_Traj::getVelocityBatch(const double *secs, double *out, int n) const
+{
+  if (_no_traj)
+  {
+    for (int i = 0; i < n; i++)
+      out[i] = 0.0;
+    return;
+  }
+
+  const double ti = _initial_time, tc = _tc, ddp = _ddp;
+  const double duration = getDuration();
+  const double t_dec = duration - tc;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = secs[i] - ti;
+    if (t < 0.0)
+      out[i] = 0.0;
+    else if (t <= tc)
+      out[i] = ddp * t;
+    else if (t <= t_dec)
+      out[i] = ddp * tc;
+    else if (t <= duration)
+      out[i] = ddp * (duration - t);
+    else
+      out[i] = 0.0;
+  }
+}
+
+/*
+    Get Acceleration at the n time instants secs[0..n-1]
+*/
+void Trapez_Traj::getAccelerationBatch(const double *secs, double *out, int n) const
+{
+  if (_no_traj)
+  {
+    for (int i = 0; i < n; i++)
+      out[i] = 0.0;
+    return;
+  }
+
+  const double ti = _initial_time, tc = _tc, ddp = _ddp;
+  const double duration = getDuration();
+  const double t_dec = duration - tc;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = secs[i] - ti;
+    if (t < 0.0)
+      out[i] = 0.0;
+    else if (t <= tc)
+      out[i] = ddp;
+    else if (t <= t_dec)
+      out[i] = 0.0;
+    else if (t <= duration)
+      out[i] = -ddp;
+    else
+      out[i] = 0.0;
+  }
+}
+
 }  // namespace sun
\ No newline at end of file
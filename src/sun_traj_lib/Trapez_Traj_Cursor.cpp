@@ -0,0 +1,113 @@
+/*
+
+    Trapez Traj Cursor
+    Cursor of a trapezoidal velocity profile with phase tracking
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Trapez_Traj_Cursor.h"
+
+namespace sun
+{
+/*
+    Constructor, the cursor is placed at time secs
+*/
+Trapez_Traj_Cursor::Trapez_Traj_Cursor(double initial_time, double initial_position, double final_position,
+                                       double acceleration, double acc_duration, double duration, double secs)
+  : _ti(initial_time), _pi(initial_position), _pf(final_position), _ddp(acceleration), _phase(BEFORE_START), _t(NAN)
+{
+  _phase_end[BEFORE_START] = 0.0;
+  _phase_end[ACCELERATION] = acc_duration;
+  _phase_end[CRUISE] = duration - acc_duration;
+  _phase_end[DECELERATION] = duration;
+  _phase_end[AFTER_END] = INFINITY;
+  seek(secs);
+}
+
+/*
+    Move the cursor to time secs
+*/
+void Trapez_Traj_Cursor::seek(double secs)
+{
+  _time = secs;
+  double t = secs - _ti;
+
+  // going back in time: restart the phase search
+  if (!(t >= _t))
+  {
+    _phase = BEFORE_START;
+  }
+  _t = t;
+
+  // BEFORE_START is left at t >= 0, the other phases at t > end
+  if (_phase == BEFORE_START && t >= 0.0)
+  {
+    _phase = ACCELERATION;
+  }
+  while (_phase != BEFORE_START && t > _phase_end[_phase])
+  {
+    _phase++;
+  }
+
+  switch (_phase)
+  {
+    case BEFORE_START:
+      _state.position = _pi;
+      _state.velocity = 0.0;
+      _state.acceleration = 0.0;
+      break;
+    case ACCELERATION:
+      _state.position = _pi + 0.5 * _ddp * t * t;
+      _state.velocity = _ddp * t;
+      _state.acceleration = _ddp;
+      break;
+    case CRUISE:
+    {
+      double tc = _phase_end[ACCELERATION];
+      _state.position = _pi + _ddp * tc * (t - (tc / 2.0));
+      _state.velocity = _ddp * tc;
+      _state.acceleration = 0.0;
+      break;
+    }
+    case DECELERATION:
+    {
+      double t_left = _phase_end[DECELERATION] - t;
+      _state.position = _pf - 0.5 * _ddp * t_left * t_left;
+      _state.velocity = _ddp * t_left;
+      _state.acceleration = -_ddp;
+      break;
+    }
+    default:
+      _state.position = _pf;
+      _state.velocity = 0.0;
+      _state.acceleration = 0.0;
+      break;
+  }
+}
+
+/*
+    Current phase
+*/
+Trapez_Traj_Cursor::Phase Trapez_Traj_Cursor::getPhase() const
+{
+  return Phase(_phase);
+}
+
+}  // namespace sun
@@ -23,6 +23,8 @@
 */
 
 #include "sun_traj_lib/Trapez_Vel_Traj.h"
+#include "sun_traj_lib/Traj_Arena.h"
+#include "sun_traj_lib/Trapez_Traj_Cursor.h"
 
 using namespace std;
 
@@ -50,9 +52,27 @@ Trapez_Vel_Traj::Trapez_Vel_Traj(
 
   if (isnan(_tc) || _tc < 0.0 || _tv < 0.0)
   {
-    cout << TRAJ_ERROR_COLOR "ERROR in Trapez_Vel_Traj() | non valid time" CRESET << endl;
-    exit(-1);
+    trajFatal("ERROR in Trapez_Vel_Traj() | non valid time");
+    // the fatal handler returned, hold the initial position
+    _ddp = 0.0;
+    _tc = 0.0;
+    _tv = 0.0;
+    _final_time = _initial_time;
+  }
+}
+
+/*
+    Non-fatal factory, validate the inputs and return the traj or an error status
+*/
+Traj_Result<Trapez_Vel_Traj> Trapez_Vel_Traj::create(double cruise_speed, double cruise_duration, double acceleration,
+                                                     double initial_position, double initial_time)
+{
+  double tc = (acceleration == 0.0 && cruise_speed == 0.0) ? 0.0 : cruise_speed / acceleration;
+  if (isnan(tc) || tc < 0.0 || !(cruise_duration >= 0.0))
+  {
+    return TRAJ_INVALID_TIME;
   }
+  return Trapez_Vel_Traj(cruise_speed, cruise_duration, acceleration, initial_position, initial_time);
 }
 
 /*
@@ -63,6 +83,22 @@ Trapez_Vel_Traj *Trapez_Vel_Traj::clone() const
   return new Trapez_Vel_Traj(*this);
 }
 
+/*
+    Clone the object in the arena
+*/
+Trapez_Vel_Traj *Trapez_Vel_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Trapez_Vel_Traj>(*this);
+}
+
+/*
+    Create in the heap a cursor placed at time secs
+*/
+Scalar_Traj_Cursor *Trapez_Vel_Traj::createCursor(double secs) const
+{
+  return new Trapez_Traj_Cursor(_initial_time, _pi, getFinalPosition(), _ddp, _tc, 2.0 * _tc + _tv, secs);
+}
+
 /*=======END CONSTRUCTORS======*/
 
 /*======= GETTERS =========*/
@@ -170,4 +206,117 @@ double Trapez_Vel_Traj::getAcceleration(double secs) const
   }
 }
 
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+Scalar_Traj_State Trapez_Vel_Traj::getState(double secs) const
+{
+  Scalar_Traj_State state;
+  state.position = _pi;
+  state.velocity = 0.0;
+  state.acceleration = 0.0;
+
+  double t = secs - _initial_time;
+
+  if (t < 0.0)
+  {
+    return state;
+  }
+  if (t <= _tc)
+  {
+    state.position = _pi + 0.5 * _ddp * pow(t, 2);
+    state.velocity = _ddp * t;
+    state.acceleration = _ddp;
+    return state;
+  }
+  if (t <= (_tc + _tv))
+  {
+    state.position = _pi + _ddp * _tc * (t - 0.5 * _tc);
+    state.velocity = _ddp * _tc;
+    return state;
+  }
+  if (t <= (2.0 * _tc + _tv))
+  {
+    state.position = _pi - 0.5 * _ddp * pow(_tc, 2) + _ddp * _tc * t - 0.5 * _ddp * pow(t - _tc - _tv, 2);
+    state.velocity = -_ddp * (t - 2.0 * _tc - _tv);
+    state.acceleration = -_ddp;
+    return state;
+  }
+  state.position = getFinalPosition();
+  return state;
+}
+
+/*
+    Get Position at the n time instants secs[0..n-1]
+*/
+void Trapez_Vel_Traj::getPositionBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, pi = _pi, tc = _tc, ddp = _ddp;
+  const double t_cruise_end = _tc + _tv;
+  const double t_end = 2.0 * _tc + _tv;
+  const double pf = getFinalPosition();
+  for (int i = 0; i < n; i++)
+  {
+    const double t = secs[i] - ti;
+    if (t < 0.0)
+      out[i] = pi;
+    else if (t <= tc)
+      out[i] = pi + 0.5 * ddp * (t * t);
+    else if (t <= t_cruise_end)
+      out[i] = pi + ddp * tc * (t - 0.5 * tc);
+    else if (t <= t_end)
+      out[i] = pi - 0.5 * ddp * (tc * tc) + ddp * tc * t - 0.5 * ddp * ((t - t_cruise_end) * (t - t_cruise_end));
+    else
+      out[i] = pf;
+  }
+}
+
+/*
+    Get Velocity at the n time instants secs[0..n-1]
+*/
+void Trapez_Vel_Traj::getVelocityBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, tc = _tc, ddp = _ddp;
+  const double t_cruise_end = _tc + _tv;
+  const double t_end = 2.0 * _tc + _tv;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = secs[i] - ti;
+    if (t < 0.0)
+      out[i] = 0.0;
+    else if (t <= tc)
+      out[i] = ddp * t;
+    else if (t <= t_cruise_end)
+      out[i] = ddp * tc;
+    else if (t <= t_end)
+      out[i] = -ddp * (t - t_end);
+    else
+      out[i] = 0.0;
+  }
+}
+
+/*
+    Get Acceleration at the n time instants secs[0..n-1]
+*/
+void Trapez_Vel_Traj::getAccelerationBatch(const double *secs, double *out, int n) const
+{
+  const double ti = _initial_time, tc = _tc, ddp = _ddp;
+  const double t_cruise_end = _tc + _tv;
+  const double t_end = 2.0 * _tc + _tv;
+  for (int i = 0; i < n; i++)
+  {
+    const double t = secs[i] - ti;
+    if (t < 0.0)
+      out[i] = 0.0;
+    else if (t <= tc)
+      out[i] = ddp;
+    else if (t <= t_cruise_end)
+      out[i] = 0.0;
+    else if (t <= t_end)
+      out[i] = -ddp;
+    else
+      out[i] = 0.0;
+  }
+}
+
 }  // namespace sun
@@ -44,35 +44,58 @@ Vector_Independent_Traj::Vector_Independent_Traj() : Vector_Traj_Interface(NAN,
 Vector_Independent_Traj::Vector_Independent_Traj(const std::vector<Scalar_Traj_Interface_Ptr> &traj_vec)
   : Vector_Traj_Interface(NAN, NAN)
 {
+  _traj_vec.reserve(traj_vec.size());
   for (const auto &element : traj_vec)
   {
-    _traj_vec.push_back(Scalar_Traj_Interface_Ptr(element->clone()));
+    _traj_vec.push_back(Scalar_Traj_Variant(*element));
   }
 }
 
 /*
-    Constructor that creates n equal trajectories
+    Full constructor, take ownership of the trajs of traj_vec
 */
-Vector_Independent_Traj::Vector_Independent_Traj(const Scalar_Traj_Interface &traj, int n)
+Vector_Independent_Traj::Vector_Independent_Traj(std::vector<Scalar_Traj_Interface_Ptr> &&traj_vec)
   : Vector_Traj_Interface(NAN, NAN)
 {
-  for (int i = 0; i < n; i++)
+  _traj_vec.reserve(traj_vec.size());
+  for (auto &element : traj_vec)
   {
-    _traj_vec.push_back(Scalar_Traj_Interface_Ptr(traj.clone()));
+    _traj_vec.push_back(Scalar_Traj_Variant(std::move(element)));
   }
+  traj_vec.clear();
+}
+
+/*
+    Constructor that creates n equal trajectories
+*/
+Vector_Independent_Traj::Vector_Independent_Traj(const Scalar_Traj_Interface &traj, int n)
+  : Vector_Traj_Interface(NAN, NAN)
+{
+  _traj_vec.assign(n, Scalar_Traj_Variant(traj));
 }
 
 /*
     Copy Constructor
 */
-Vector_Independent_Traj::Vector_Independent_Traj(const Vector_Independent_Traj &traj) : Vector_Traj_Interface(traj)
+Vector_Independent_Traj::Vector_Independent_Traj(const Vector_Independent_Traj &traj)
+  : Vector_Traj_Interface(traj), _traj_vec(traj._traj_vec)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+}
+
+/*
+    Copy Constructor, the vector of the trajs and the non built-in trajs are allocated in arena
+*/
+Vector_Independent_Traj::Vector_Independent_Traj(const Vector_Independent_Traj &traj, Traj_Arena &arena)
+  : Vector_Traj_Interface(traj), _traj_vec(Traj_Allocator<Scalar_Traj_Variant>(arena))
 {
   _initial_time = NAN;
   _final_time = NAN;
-  // Clone traj
-  for (const auto &element : traj._traj_vec)
+  _traj_vec.reserve(traj._traj_vec.size());
+  for (const auto &scalar_traj : traj._traj_vec)
   {
-    _traj_vec.push_back(Scalar_Traj_Interface_Ptr(element->clone()));
+    _traj_vec.emplace_back(scalar_traj, arena);
   }
 }
 
@@ -84,6 +107,70 @@ Vector_Independent_Traj *Vector_Independent_Traj::clone() const
   return new Vector_Independent_Traj(*this);
 }
 
+/*
+    Clone the object and the vector of the trajs in the arena
+*/
+Vector_Independent_Traj *Vector_Independent_Traj::cloneInto(Traj_Arena &arena) const
+{
+  return arena.construct<Vector_Independent_Traj>(*this, arena);
+}
+
+/*
+    Synchronized factory
+    Joint i moves h_i = |final_i - initial_i| with cruise speed v_i = h_i / (T - tc) and acceleration v_i / tc,
+    tc is the acceleration time (common to all the joints). With d = T - tc the limits are
+      d >= V = max_i h_i / max_velocity_i   and   tc * d >= A = max_i h_i / max_acceleration_i
+    T = d + tc is minimum for tc = A / d and d = max(V, sqrt(A)), so d >= tc
+    (in floating point A / sqrt(A) can be one ulp above sqrt(A): tc is clamped to d)
+*/
+Traj_Result<Vector_Independent_Traj> Vector_Independent_Traj::createSynchronized(const Vector<> &initial_position,
+                                                                                 const Vector<> &final_position,
+                                                                                 const Vector<> &max_velocity,
+                                                                                 const Vector<> &max_acceleration,
+                                                                                 double initial_time)
+{
+  const int n = initial_position.size();
+  if (final_position.size() != n || max_velocity.size() != n || max_acceleration.size() != n ||
+      !std::isfinite(initial_time))
+  {
+    return TRAJ_INVALID_ARGUMENT;
+  }
+
+  double V = 0.0, A = 0.0;
+  for (int i = 0; i < n; i++)
+  {
+    const double h = fabs(final_position[i] - initial_position[i]);
+    if (!std::isfinite(h) || !(max_velocity[i] > 0.0) || !(max_acceleration[i] > 0.0) ||
+        !std::isfinite(max_velocity[i]) || !std::isfinite(max_acceleration[i]))
+    {
+      return TRAJ_INVALID_ARGUMENT;
+    }
+    V = std::max(V, h / max_velocity[i]);
+    A = std::max(A, h / max_acceleration[i]);
+  }
+
+  const double d = std::max(V, sqrt(A));
+  // d = 0 -> no motion on all the joints
+  const double tc = (d > 0.0) ? std::min(A / d, d) : 0.0;
+
+  Vector_Independent_Traj traj;
+  traj._traj_vec.reserve(n);
+  for (int i = 0; i < n; i++)
+  {
+    if (final_position[i] == initial_position[i])
+    {
+      // joint at rest for the whole duration
+      traj._traj_vec.push_back(
+          Scalar_Traj_Variant(Trapez_Traj(d + tc, initial_position[i], initial_position[i], 0.0, initial_time)));
+      continue;
+    }
+    const double cruise_speed = (final_position[i] - initial_position[i]) / d;
+    traj._traj_vec.push_back(Scalar_Traj_Variant(
+        Trapez_Vel_Traj(cruise_speed, d - tc, cruise_speed / tc, initial_position[i], initial_time)));
+  }
+  return traj;
+}
+
 /* ====== END CONSTRUCTORS =======*/
 
 /* ====== SETTERS =========*/
@@ -93,7 +180,15 @@ Vector_Independent_Traj *Vector_Independent_Traj::clone() const
 */
 void Vector_Independent_Traj::push_back_traj(const Scalar_Traj_Interface &traj)
 {
-  _traj_vec.push_back(Scalar_Traj_Interface_Ptr(traj.clone()));
+  _traj_vec.push_back(Scalar_Traj_Variant(traj));
+}
+
+/*
+    Push back a trajectory in the vector taking ownership of traj
+*/
+void Vector_Independent_Traj::push_back_traj(Scalar_Traj_Interface_Ptr &&traj)
+{
+  _traj_vec.push_back(Scalar_Traj_Variant(std::move(traj)));
 }
 
 /*
@@ -125,7 +220,7 @@ double Vector_Independent_Traj::getFinalTime() const
   double final_time = -INFINITY;
   for (const auto &element : _traj_vec)
   {
-    double ith_final_time = element->getFinalTime();
+    double ith_final_time = element.getFinalTime();
     if (ith_final_time > final_time)
       final_time = ith_final_time;
   }
@@ -141,7 +236,7 @@ double Vector_Independent_Traj::getInitialTime() const
   double initial_time = INFINITY;
   for (const auto &element : _traj_vec)
   {
-    double ith_initial_time = element->getInitialTime();
+    double ith_initial_time = element.getInitialTime();
     if (ith_initial_time < initial_time)
       initial_time = ith_initial_time;
   }
@@ -161,7 +256,7 @@ void Vector_Independent_Traj::changeInitialTime(double initial_time)
   double Delta_T = previous_initial_time - initial_time;
   for (auto &element : _traj_vec)
   {
-    element->changeInitialTime(element->getInitialTime() - Delta_T);
+    element.changeInitialTime(element.getInitialTime() - Delta_T);
   }
 }
 
@@ -174,7 +269,7 @@ bool Vector_Independent_Traj::isCompleate(double secs) const
 {
   for (const auto &element : _traj_vec)
   {
-    if (!element->isCompleate(secs))
+    if (!element.isCompleate(secs))
       return false;
   }
   return true;
@@ -187,7 +282,7 @@ bool Vector_Independent_Traj::isStarted(double secs) const
 {
   for (const auto &element : _traj_vec)
   {
-    if (element->isStarted(secs))
+    if (element.isStarted(secs))
       return true;
   }
   return false;
@@ -200,11 +295,8 @@ bool Vector_Independent_Traj::isStarted(double secs) const
 */
 Vector<> Vector_Independent_Traj::getPosition(double secs) const
 {
-  Vector<> out = NAN * Ones(_traj_vec.size());
-  for (int i = 0; i < _traj_vec.size(); i++)
-  {
-    out[i] = _traj_vec[i]->getPosition(secs);
-  }
+  Vector<> out(_traj_vec.size());
+  writePosition(secs, out.get_data_ptr());
   return out;
 }
 
@@ -213,11 +305,8 @@ Vector<> Vector_Independent_Traj::getPosition(double secs) const
 */
 Vector<> Vector_Independent_Traj::getVelocity(double secs) const
 {
-  Vector<> out = NAN * Ones(_traj_vec.size());
-  for (int i = 0; i < _traj_vec.size(); i++)
-  {
-    out[i] = _traj_vec[i]->getVelocity(secs);
-  }
+  Vector<> out(_traj_vec.size());
+  writeVelocity(secs, out.get_data_ptr());
   return out;
 }
 
@@ -226,12 +315,61 @@ Vector<> Vector_Independent_Traj::getVelocity(double secs) const
 */
 Vector<> Vector_Independent_Traj::getAcceleration(double secs) const
 {
-  Vector<> out = NAN * Ones(_traj_vec.size());
-  for (int i = 0; i < _traj_vec.size(); i++)
+  Vector<> out(_traj_vec.size());
+  writeAcceleration(secs, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Write Position at time secs in out
+*/
+void Vector_Independent_Traj::writePosition(double secs, double *out) const
+{
+  for (int i = 0; i < int(_traj_vec.size()); i++)
   {
-    out[i] = _traj_vec[i]->getAcceleration(secs);
+    out[i] = _traj_vec[i].getPosition(secs);
+  }
+}
+
+/*
+    Write Velocity at time secs in out
+*/
+void Vector_Independent_Traj::writeVelocity(double secs, double *out) const
+{
+  for (int i = 0; i < int(_traj_vec.size()); i++)
+  {
+    out[i] = _traj_vec[i].getVelocity(secs);
+  }
+}
+
+/*
+    Write Acceleration at time secs in out
+*/
+void Vector_Independent_Traj::writeAcceleration(double secs, double *out) const
+{
+  for (int i = 0; i < int(_traj_vec.size()); i++)
+  {
+    out[i] = _traj_vec[i].getAcceleration(secs);
+  }
+}
+
+/*
+    Write Position, Velocity and Acceleration at time secs in pos, vel and acc, a null pointer is skipped
+*/
+void Vector_Independent_Traj::writeState(double secs, double *pos, double *vel, double *acc) const
+{
+  if (!pos || !vel || !acc)
+  {
+    Vector_Traj_Interface::writeState(secs, pos, vel, acc);
+    return;
+  }
+  for (int i = 0; i < int(_traj_vec.size()); i++)
+  {
+    Scalar_Traj_State state = _traj_vec[i].getState(secs);
+    pos[i] = state.position;
+    vel[i] = state.velocity;
+    acc[i] = state.acceleration;
   }
-  return out;
 }
 
 /*====== END RUNNERS =========*/
@@ -0,0 +1,298 @@
+/*
+
+    Vector OTG Traj
+    Vectorial trajectory for online trajectory generation (one OTG_Traj per joint)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Vector_OTG_Traj.h"
+
+using namespace TooN;
+using namespace std;
+
+namespace sun
+{
+/*======CONSTRUCTORS========*/
+
+/*
+    Constructor
+*/
+Vector_OTG_Traj::Vector_OTG_Traj(const Vector<> &initial_position, const Vector<> &initial_velocity,
+                                 const Vector<> &final_position, const Vector<> &max_velocity,
+                                 const Vector<> &max_acceleration, double initial_time)
+  : Vector_Traj_Interface(0.0, initial_time)
+{
+  const int n = initial_position.size();
+  _joint_trajs.reserve(n);
+  if (initial_velocity.size() != n || final_position.size() != n || max_velocity.size() != n ||
+      max_acceleration.size() != n)
+  {
+    trajFatal("ERROR in Vector_OTG_Traj() | size mismatch: initial_position=%d initial_velocity=%d "
+              "final_position=%d max_velocity=%d max_acceleration=%d",
+              n, initial_velocity.size(), final_position.size(), max_velocity.size(), max_acceleration.size());
+    // the fatal handler returned, hold the initial position
+    _max_velocity.assign(n, 1.0);
+    _max_acceleration.assign(n, 1.0);
+    for (int i = 0; i < n; i++)
+    {
+      _joint_trajs.push_back(OTG_Traj(initial_position[i], 0.0, initial_position[i], 1.0, 1.0, initial_time));
+    }
+    updateTimes();
+    return;
+  }
+
+  _max_velocity.assign(max_velocity.get_data_ptr(), max_velocity.get_data_ptr() + n);
+  _max_acceleration.assign(max_acceleration.get_data_ptr(), max_acceleration.get_data_ptr() + n);
+  for (int i = 0; i < n; i++)
+  {
+    _joint_trajs.push_back(OTG_Traj(initial_position[i], initial_velocity[i], final_position[i], _max_velocity[i],
+                                    _max_acceleration[i], initial_time));
+  }
+  updateTimes();
+}
+
+/*
+    Clone the object in the heap
+*/
+Vector_OTG_Traj *Vector_OTG_Traj::clone() const
+{
+  return new Vector_OTG_Traj(*this);
+}
+
+/*
+    Update the initial (min) and final (max) time from the joint trajs
+*/
+void Vector_OTG_Traj::updateTimes()
+{
+  if (_joint_trajs.empty())
+  {
+    _final_time = _initial_time;
+    return;
+  }
+  _initial_time = _joint_trajs[0].getInitialTime();
+  _final_time = _joint_trajs[0].getFinalTime();
+  for (const auto &traj : _joint_trajs)
+  {
+    _initial_time = std::min(_initial_time, traj.getInitialTime());
+    _final_time = std::max(_final_time, traj.getFinalTime());
+  }
+}
+
+/*======END CONSTRUCTORS========*/
+
+/*====== GETTERS =========*/
+
+/*
+    get size of the vector
+*/
+int Vector_OTG_Traj::size() const
+{
+  return _joint_trajs.size();
+}
+
+/*
+    Get the traj of joint i
+*/
+const OTG_Traj &Vector_OTG_Traj::getJointTraj(int i) const
+{
+  return _joint_trajs[i];
+}
+
+/*====== END GETTERS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Change the initial time instant (translate all the trajectories in the time)
+*/
+void Vector_OTG_Traj::changeInitialTime(double initial_time)
+{
+  double Delta_T = initial_time - getInitialTime();
+  for (auto &traj : _joint_trajs)
+  {
+    traj.changeInitialTime(traj.getInitialTime() + Delta_T);
+  }
+  Vector_Traj_Interface::changeInitialTime(initial_time);
+}
+
+/*
+    Set the limits, used by the next replan()
+    The limits are validated here (as in OTG_Traj::checkOTG), so that replan() cannot fail on them
+*/
+bool Vector_OTG_Traj::setLimits(const Vector<> &max_velocity, const Vector<> &max_acceleration)
+{
+  if (max_velocity.size() != size() || max_acceleration.size() != size())
+  {
+    trajFatal("ERROR in Vector_OTG_Traj::setLimits() | size mismatch: size=%d max_velocity=%d max_acceleration=%d",
+              size(), max_velocity.size(), max_acceleration.size());
+    return false;
+  }
+  for (int i = 0; i < size(); i++)
+  {
+    if (!isfinite(max_velocity[i]) || !isfinite(max_acceleration[i]) || !(max_velocity[i] > 0.0) ||
+        !(max_acceleration[i] > 0.0))
+    {
+      trajDiagnostic(TRAJ_DIAG_ERROR,
+                     "Error in Vector_OTG_Traj::setLimits() | joint %d: non valid max_velocity=%g max_acceleration=%g "
+                     "(limits have to be > 0), the limits are not changed",
+                     i, max_velocity[i], max_acceleration[i]);
+      return false;
+    }
+  }
+  for (int i = 0; i < size(); i++)
+  {
+    _max_velocity[i] = max_velocity[i];
+    _max_acceleration[i] = max_acceleration[i];
+  }
+  return true;
+}
+
+/*====== END SETTERS =========*/
+
+/*====== REPLAN =========*/
+
+/*
+    Replan from the state of the current traj at time secs to final_position
+*/
+void Vector_OTG_Traj::replan(double secs, const Vector<> &final_position)
+{
+  if (final_position.size() != size())
+  {
+    trajFatal("ERROR in Vector_OTG_Traj::replan() | size mismatch: size=%d final_position=%d", size(),
+              final_position.size());
+    return;
+  }
+  for (int i = 0; i < size(); i++)
+  {
+    Scalar_Traj_State state = _joint_trajs[i].getState(secs);
+    _joint_trajs[i] = OTG_Traj(state.position, state.velocity, final_position[i], _max_velocity[i],
+                               _max_acceleration[i], secs);
+  }
+  updateTimes();
+}
+
+/*
+    Replan from the state (position, velocity) at time secs to final_position
+*/
+void Vector_OTG_Traj::replan(double secs, const Vector<> &position, const Vector<> &velocity,
+                             const Vector<> &final_position)
+{
+  if (position.size() != size() || velocity.size() != size() || final_position.size() != size())
+  {
+    trajFatal("ERROR in Vector_OTG_Traj::replan() | size mismatch: size=%d position=%d velocity=%d "
+              "final_position=%d",
+              size(), position.size(), velocity.size(), final_position.size());
+    return;
+  }
+  for (int i = 0; i < size(); i++)
+  {
+    _joint_trajs[i] =
+        OTG_Traj(position[i], velocity[i], final_position[i], _max_velocity[i], _max_acceleration[i], secs);
+  }
+  updateTimes();
+}
+
+/*====== END REPLAN =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Position at time secs
+*/
+Vector<> Vector_OTG_Traj::getPosition(double secs) const
+{
+  Vector<> out(size());
+  writePosition(secs, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Get Velocity at time secs
+*/
+Vector<> Vector_OTG_Traj::getVelocity(double secs) const
+{
+  Vector<> out(size());
+  writeVelocity(secs, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Get Acceleration at time secs
+*/
+Vector<> Vector_OTG_Traj::getAcceleration(double secs) const
+{
+  Vector<> out(size());
+  writeAcceleration(secs, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Write Position at time secs in out
+*/
+void Vector_OTG_Traj::writePosition(double secs, double *out) const
+{
+  for (int i = 0; i < size(); i++)
+  {
+    out[i] = _joint_trajs[i].getPosition(secs);
+  }
+}
+
+/*
+    Write Velocity at time secs in out
+*/
+void Vector_OTG_Traj::writeVelocity(double secs, double *out) const
+{
+  for (int i = 0; i < size(); i++)
+  {
+    out[i] = _joint_trajs[i].getVelocity(secs);
+  }
+}
+
+/*
+    Write Acceleration at time secs in out
+*/
+void Vector_OTG_Traj::writeAcceleration(double secs, double *out) const
+{
+  for (int i = 0; i < size(); i++)
+  {
+    out[i] = _joint_trajs[i].getAcceleration(secs);
+  }
+}
+
+/*
+    Write Position, Velocity and Acceleration at time secs in pos, vel and acc, a null pointer is skipped
+*/
+void Vector_OTG_Traj::writeState(double secs, double *pos, double *vel, double *acc) const
+{
+  for (int i = 0; i < size(); i++)
+  {
+    Scalar_Traj_State state = _joint_trajs[i].getState(secs);
+    if (pos)
+      pos[i] = state.position;
+    if (vel)
+      vel[i] = state.velocity;
+    if (acc)
+      acc[i] = state.acceleration;
+  }
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
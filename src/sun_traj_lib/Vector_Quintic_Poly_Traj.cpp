@@ -0,0 +1,375 @@
+/*
+
+    Vector Quintic Poly Traj Class
+    This class generates a vector trajectory of independent quintic polys (SoA layout)
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Vector_Quintic_Poly_Traj.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// SIMD width in doubles, columns are padded to a multiple of it
+#define VECTOR_QUINTIC_POLY_SIMD_WIDTH 4
+
+using namespace TooN;
+using namespace std;
+
+namespace sun
+{
+/*======CONSTRUCTORS========*/
+
+/*
+    Constructor, all the joints start at rest and end at rest
+*/
+Vector_Quintic_Poly_Traj::Vector_Quintic_Poly_Traj(double duration, const Vector<> &initial_position,
+                                                   const Vector<> &final_position, double initial_time)
+  : Vector_Traj_Interface(duration, initial_time)
+{
+  const int n = initial_position.size();
+  std::vector<Quintic_Poly_Traj> joint_trajs;
+  joint_trajs.reserve(n);
+  if (final_position.size() != n)
+  {
+    trajFatal("ERROR in Vector_Quintic_Poly_Traj() | size mismatch: initial_position=%d final_position=%d", n,
+              final_position.size());
+    // the fatal handler returned, hold the initial position
+    for (int i = 0; i < n; i++)
+    {
+      joint_trajs.push_back(Quintic_Poly_Traj(duration, initial_position[i], initial_position[i], initial_time));
+    }
+    init(joint_trajs);
+    return;
+  }
+  for (int i = 0; i < n; i++)
+  {
+    joint_trajs.push_back(Quintic_Poly_Traj(duration, initial_position[i], final_position[i], initial_time));
+  }
+  init(joint_trajs);
+}
+
+/*
+    Full Constructor
+*/
+Vector_Quintic_Poly_Traj::Vector_Quintic_Poly_Traj(double duration, const Vector<> &initial_position,
+                                                   const Vector<> &final_position, double initial_time,
+                                                   const Vector<> &initial_velocity, const Vector<> &final_velocity,
+                                                   const Vector<> &initial_acceleration,
+                                                   const Vector<> &final_acceleration)
+  : Vector_Traj_Interface(duration, initial_time)
+{
+  const int n = initial_position.size();
+  std::vector<Quintic_Poly_Traj> joint_trajs;
+  joint_trajs.reserve(n);
+  if (final_position.size() != n || initial_velocity.size() != n || final_velocity.size() != n ||
+      initial_acceleration.size() != n || final_acceleration.size() != n)
+  {
+    trajFatal("ERROR in Vector_Quintic_Poly_Traj() | size mismatch: initial_position=%d final_position=%d "
+              "initial_velocity=%d final_velocity=%d initial_acceleration=%d final_acceleration=%d",
+              n, final_position.size(), initial_velocity.size(), final_velocity.size(), initial_acceleration.size(),
+              final_acceleration.size());
+    // the fatal handler returned, hold the initial position
+    for (int i = 0; i < n; i++)
+    {
+      joint_trajs.push_back(Quintic_Poly_Traj(duration, initial_position[i], initial_position[i], initial_time));
+    }
+    init(joint_trajs);
+    return;
+  }
+  for (int i = 0; i < n; i++)
+  {
+    joint_trajs.push_back(Quintic_Poly_Traj(duration, initial_position[i], final_position[i], initial_time,
+                                            initial_velocity[i], final_velocity[i], initial_acceleration[i],
+                                            final_acceleration[i]));
+  }
+  init(joint_trajs);
+}
+
+/*
+    Constructor from a vector of Quintic Polys, each one can have its own time interval
+*/
+Vector_Quintic_Poly_Traj::Vector_Quintic_Poly_Traj(const std::vector<Quintic_Poly_Traj> &joint_trajs)
+  : Vector_Traj_Interface(0.0, 0.0)
+{
+  init(joint_trajs);
+  if (_size > 0)
+  {
+    _initial_time = INFINITY;
+    _final_time = -INFINITY;
+  }
+  for (int i = 0; i < _size; i++)
+  {
+    if (col(COL_TI)[i] < _initial_time)
+      _initial_time = col(COL_TI)[i];
+    if (col(COL_TF)[i] > _final_time)
+      _final_time = col(COL_TF)[i];
+  }
+}
+
+/*
+    Allocate the columns and fill them from the joint trajs
+*/
+void Vector_Quintic_Poly_Traj::init(const std::vector<Quintic_Poly_Traj> &joint_trajs)
+{
+  _size = joint_trajs.size();
+  _stride = VECTOR_QUINTIC_POLY_SIMD_WIDTH *
+            ((_size + VECTOR_QUINTIC_POLY_SIMD_WIDTH - 1) / VECTOR_QUINTIC_POLY_SIMD_WIDTH);
+  // the padding lanes are zeros, i.e. a still joint at 0
+  _data.assign(NUM_COLS * _stride, 0.0);
+
+  for (int i = 0; i < _size; i++)
+  {
+    const Quintic_Poly_Traj &traj = joint_trajs[i];
+    col(COL_TI)[i] = traj.getInitialTime();
+    col(COL_TF)[i] = traj.getFinalTime();
+    col(COL_PI)[i] = traj.getInitialPosition();
+    col(COL_PF)[i] = traj.getFinalPosition();
+
+    Vector<6> p_coeff = traj.getPolyCoeff();
+    Vector<5> v_coeff = polydiff(p_coeff);
+    Vector<4> a_coeff = polydiff(v_coeff);
+    for (int k = 0; k < 6; k++)
+      col(COL_P + k)[i] = p_coeff[k];
+    for (int k = 0; k < 5; k++)
+      col(COL_V + k)[i] = v_coeff[k];
+    for (int k = 0; k < 4; k++)
+      col(COL_A + k)[i] = a_coeff[k];
+  }
+}
+
+/*
+    Clone the object in the heap
+*/
+Vector_Quintic_Poly_Traj *Vector_Quintic_Poly_Traj::clone() const
+{
+  return new Vector_Quintic_Poly_Traj(*this);
+}
+
+/*======END CONSTRUCTORS========*/
+
+/*====== GETTERS =========*/
+
+/*
+    get size of the vector
+*/
+int Vector_Quintic_Poly_Traj::size() const
+{
+  return _size;
+}
+
+/*====== END GETTERS =========*/
+
+/*====== SETTERS =========*/
+
+/*
+    Change the initial time instant (translate all the trajectories in the time)
+*/
+void Vector_Quintic_Poly_Traj::changeInitialTime(double initial_time)
+{
+  double Delta_T = initial_time - getInitialTime();
+  for (int i = 0; i < _size; i++)
+  {
+    col(COL_TI)[i] += Delta_T;
+    col(COL_TF)[i] += Delta_T;
+  }
+  Vector_Traj_Interface::changeInitialTime(initial_time);
+}
+
+/*====== END SETTERS =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Position at time secs
+*/
+Vector<> Vector_Quintic_Poly_Traj::getPosition(double secs) const
+{
+  Vector<> out(_size);
+  writeState(secs, out.get_data_ptr(), nullptr, nullptr);
+  return out;
+}
+
+/*
+    Get Velocity at time secs
+*/
+Vector<> Vector_Quintic_Poly_Traj::getVelocity(double secs) const
+{
+  Vector<> out(_size);
+  writeState(secs, nullptr, out.get_data_ptr(), nullptr);
+  return out;
+}
+
+/*
+    Get Acceleration at time secs
+*/
+Vector<> Vector_Quintic_Poly_Traj::getAcceleration(double secs) const
+{
+  Vector<> out(_size);
+  writeState(secs, nullptr, nullptr, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Write Position at time secs in out
+*/
+void Vector_Quintic_Poly_Traj::writePosition(double secs, double *out) const
+{
+  writeState(secs, out, nullptr, nullptr);
+}
+
+/*
+    Write Velocity at time secs in out
+*/
+void Vector_Quintic_Poly_Traj::writeVelocity(double secs, double *out) const
+{
+  writeState(secs, nullptr, out, nullptr);
+}
+
+/*
+    Write Acceleration at time secs in out
+*/
+void Vector_Quintic_Poly_Traj::writeAcceleration(double secs, double *out) const
+{
+  writeState(secs, nullptr, nullptr, out);
+}
+
+#if defined(__AVX__)
+
+#if defined(__FMA__)
+#define VECTOR_QUINTIC_MADD(a, b, c) _mm256_fmadd_pd(a, b, c)
+#else
+#define VECTOR_QUINTIC_MADD(a, b, c) _mm256_add_pd(_mm256_mul_pd(a, b), c)
+#endif
+
+/*
+    Get Position, Velocity and Acceleration at time secs
+    AVX version: 4 joints per step, aligned loads from the columns
+*/
+void Vector_Quintic_Poly_Traj::writeState(double secs, double *pos, double *vel, double *acc) const
+{
+  const __m256d s = _mm256_set1_pd(secs);
+  double tail[3][VECTOR_QUINTIC_POLY_SIMD_WIDTH];
+
+  for (int j = 0; j < _size; j += VECTOR_QUINTIC_POLY_SIMD_WIDTH)
+  {
+    const bool full_block = (j + VECTOR_QUINTIC_POLY_SIMD_WIDTH <= _size);
+
+    const __m256d ti = _mm256_load_pd(col(COL_TI) + j);
+    const __m256d t = _mm256_sub_pd(s, ti);
+    const __m256d before = _mm256_cmp_pd(s, ti, _CMP_LT_OQ);
+    const __m256d after = _mm256_cmp_pd(s, _mm256_load_pd(col(COL_TF) + j), _CMP_GT_OQ);
+    const __m256d outside = _mm256_or_pd(before, after);
+
+    if (pos)
+    {
+      __m256d p = _mm256_load_pd(col(COL_P) + j);
+      for (int k = 1; k < 6; k++)
+        p = VECTOR_QUINTIC_MADD(p, t, _mm256_load_pd(col(COL_P + k) + j));
+      p = _mm256_blendv_pd(p, _mm256_load_pd(col(COL_PI) + j), before);
+      p = _mm256_blendv_pd(p, _mm256_load_pd(col(COL_PF) + j), after);
+      _mm256_storeu_pd(full_block ? pos + j : tail[0], p);
+    }
+    if (vel)
+    {
+      __m256d v = _mm256_load_pd(col(COL_V) + j);
+      for (int k = 1; k < 5; k++)
+        v = VECTOR_QUINTIC_MADD(v, t, _mm256_load_pd(col(COL_V + k) + j));
+      _mm256_storeu_pd(full_block ? vel + j : tail[1], _mm256_andnot_pd(outside, v));
+    }
+    if (acc)
+    {
+      __m256d a = _mm256_load_pd(col(COL_A) + j);
+      for (int k = 1; k < 4; k++)
+        a = VECTOR_QUINTIC_MADD(a, t, _mm256_load_pd(col(COL_A + k) + j));
+      _mm256_storeu_pd(full_block ? acc + j : tail[2], _mm256_andnot_pd(outside, a));
+    }
+
+    if (!full_block)
+    {
+      // partial last block, copy only the valid lanes
+      for (int i = j; i < _size; i++)
+      {
+        if (pos)
+          pos[i] = tail[0][i - j];
+        if (vel)
+          vel[i] = tail[1][i - j];
+        if (acc)
+          acc[i] = tail[2][i - j];
+      }
+    }
+  }
+}
+
+#undef VECTOR_QUINTIC_MADD
+
+#else
+
+/*
+    Get Position, Velocity and Acceleration at time secs
+    Portable version: plain loops over the columns (auto-vectorizable)
+*/
+void Vector_Quintic_Poly_Traj::writeState(double secs, double *pos, double *vel, double *acc) const
+{
+  const double *ti = col(COL_TI);
+  const double *tf = col(COL_TF);
+
+  if (pos)
+  {
+    const double *pi = col(COL_PI);
+    const double *pf = col(COL_PF);
+    const double *c0 = col(COL_P), *c1 = col(COL_P + 1), *c2 = col(COL_P + 2), *c3 = col(COL_P + 3),
+                 *c4 = col(COL_P + 4), *c5 = col(COL_P + 5);
+    for (int i = 0; i < _size; i++)
+    {
+      const double t = secs - ti[i];
+      const double p = ((((c0[i] * t + c1[i]) * t + c2[i]) * t + c3[i]) * t + c4[i]) * t + c5[i];
+      pos[i] = (secs < ti[i]) ? pi[i] : ((secs > tf[i]) ? pf[i] : p);
+    }
+  }
+  if (vel)
+  {
+    const double *c0 = col(COL_V), *c1 = col(COL_V + 1), *c2 = col(COL_V + 2), *c3 = col(COL_V + 3),
+                 *c4 = col(COL_V + 4);
+    for (int i = 0; i < _size; i++)
+    {
+      const double t = secs - ti[i];
+      const double v = (((c0[i] * t + c1[i]) * t + c2[i]) * t + c3[i]) * t + c4[i];
+      vel[i] = (secs < ti[i] || secs > tf[i]) ? 0.0 : v;
+    }
+  }
+  if (acc)
+  {
+    const double *c0 = col(COL_A), *c1 = col(COL_A + 1), *c2 = col(COL_A + 2), *c3 = col(COL_A + 3);
+    for (int i = 0; i < _size; i++)
+    {
+      const double t = secs - ti[i];
+      const double a = ((c0[i] * t + c1[i]) * t + c2[i]) * t + c3[i];
+      acc[i] = (secs < ti[i] || secs > tf[i]) ? 0.0 : a;
+    }
+  }
+}
+
+#endif
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun
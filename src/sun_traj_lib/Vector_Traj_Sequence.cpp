@@ -0,0 +1,258 @@
+/*
+
+    Vector Traj Sequence
+    Vector traj made of a sequence of vector trajs
+
+    Copyright 2020 Università della Campania Luigi Vanvitelli
+
+    Author: Marco Costanzo <marco.costanzo@unicampania.it>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "sun_traj_lib/Vector_Traj_Sequence.h"
+
+using namespace TooN;
+
+namespace sun
+{
+/* ====== CONSTRUCTORS =======*/
+
+/*
+    Void Constructor (empty sequence)
+*/
+Vector_Traj_Sequence::Vector_Traj_Sequence() : Vector_Traj_Interface(NAN, NAN), _dim(-1)
+{
+}
+
+/*
+    Full constructor
+*/
+Vector_Traj_Sequence::Vector_Traj_Sequence(const std::vector<Vector_Traj_Interface_Ptr>& traj_vec)
+  : Vector_Traj_Interface(NAN, NAN), _dim(-1)
+{
+  _traj_vec.reserve(traj_vec.size());
+  for (const auto& element : traj_vec)
+  {
+    push_back_traj(*element);
+  }
+}
+
+/*
+    Copy Constructor
+*/
+Vector_Traj_Sequence::Vector_Traj_Sequence(const Vector_Traj_Sequence& traj)
+  : Vector_Traj_Interface(traj), _index(traj._index), _dim(traj._dim)
+{
+  _initial_time = NAN;
+  _final_time = NAN;
+  _traj_vec.reserve(traj._traj_vec.size());
+  for (const auto& element : traj._traj_vec)
+  {
+    _traj_vec.push_back(Vector_Traj_Interface_Ptr(element->clone()));
+  }
+}
+
+/*
+    Clone the object in the heap
+*/
+Vector_Traj_Sequence* Vector_Traj_Sequence::clone() const
+{
+  return new Vector_Traj_Sequence(*this);
+}
+
+/* ====== END CONSTRUCTORS =======*/
+
+/* ====== SETTERS =========*/
+
+/*
+    Push back a trajectory in the sequence
+*/
+bool Vector_Traj_Sequence::push_back_traj(const Vector_Traj_Interface& traj)
+{
+  if (!_index.canPushBack(traj.getInitialTime()))
+  {
+    trajDiagnostic(TRAJ_DIAG_ERROR,
+                   "Error in Vector_Traj_Sequence::push_back_traj() | initial time %f is before the last segment",
+                   traj.getInitialTime());
+    return false;
+  }
+  int dim = traj.getPosition(traj.getInitialTime()).size();
+  if (_dim >= 0 && dim != _dim)
+  {
+    trajDiagnostic(TRAJ_DIAG_ERROR, "Error in Vector_Traj_Sequence::push_back_traj() | size %d != %d", dim, _dim);
+    return false;
+  }
+  _dim = dim;
+  _traj_vec.push_back(Vector_Traj_Interface_Ptr(traj.clone()));
+  _index.push_back(traj.getInitialTime(), traj.getFinalTime());
+  return true;
+}
+
+/*
+    Remove last traj of the sequence
+*/
+void Vector_Traj_Sequence::pop_back_traj()
+{
+  _traj_vec.pop_back();
+  _index.pop_back();
+  if (_traj_vec.empty())
+    _dim = -1;
+}
+
+/*
+    Remove all the trajs of the sequence
+*/
+void Vector_Traj_Sequence::clear()
+{
+  _traj_vec.clear();
+  _index.clear();
+  _dim = -1;
+}
+
+/*
+    Change the initial time instant (translate all the trajectories in the time)
+*/
+void Vector_Traj_Sequence::changeInitialTime(double initial_time)
+{
+  double Delta_T = initial_time - getInitialTime();
+  for (auto& element : _traj_vec)
+  {
+    element->changeInitialTime(element->getInitialTime() + Delta_T);
+  }
+  _index.shift(Delta_T);
+}
+
+/* ====== END SETTERS =========*/
+
+/*====== GETTERS =========*/
+
+/*
+    Number of segments
+*/
+int Vector_Traj_Sequence::size() const
+{
+  return _traj_vec.size();
+}
+
+/*
+    Size of the vector trajs (-1 if the sequence is empty)
+*/
+int Vector_Traj_Sequence::getDim() const
+{
+  return _dim;
+}
+
+/*
+    Get the i-th segment
+*/
+const Vector_Traj_Interface& Vector_Traj_Sequence::getTraj(int i) const
+{
+  return *_traj_vec[i];
+}
+
+/*
+    Index of the active segment at time secs
+*/
+int Vector_Traj_Sequence::getSegmentIndex(double secs) const
+{
+  return _index.find(secs);
+}
+
+/*
+    Get the final time instant
+*/
+double Vector_Traj_Sequence::getFinalTime() const
+{
+  return _index.getFinalTime();
+}
+
+/*
+    Get the initial time instant
+*/
+double Vector_Traj_Sequence::getInitialTime() const
+{
+  return _index.getInitialTime();
+}
+
+/*====== END GETTERS =========*/
+
+/*====== RUNNERS =========*/
+
+/*
+    Get Position at time secs
+*/
+Vector<> Vector_Traj_Sequence::getPosition(double secs) const
+{
+  Vector<> out(_dim);
+  writePosition(secs, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Get Velocity at time secs
+*/
+Vector<> Vector_Traj_Sequence::getVelocity(double secs) const
+{
+  Vector<> out(_dim);
+  writeVelocity(secs, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Get Acceleration at time secs
+*/
+Vector<> Vector_Traj_Sequence::getAcceleration(double secs) const
+{
+  Vector<> out(_dim);
+  writeAcceleration(secs, out.get_data_ptr());
+  return out;
+}
+
+/*
+    Write Position at time secs in out
+*/
+void Vector_Traj_Sequence::writePosition(double secs, double* out) const
+{
+  _traj_vec[_index.find(secs)]->getPositionInto(secs, out);
+}
+
+/*
+    Write Velocity at time secs in out
+*/
+void Vector_Traj_Sequence::writeVelocity(double secs, double* out) const
+{
+  _traj_vec[_index.find(secs)]->getVelocityInto(secs, out);
+}
+
+/*
+    Write Acceleration at time secs in out
+*/
+void Vector_Traj_Sequence::writeAcceleration(double secs, double* out) const
+{
+  _traj_vec[_index.find(secs)]->getAccelerationInto(secs, out);
+}
+
+/*
+    Get Position, Velocity and Acceleration at time secs
+*/
+void Vector_Traj_Sequence::writeState(double secs, double* pos, double* vel, double* acc) const
+{
+  _traj_vec[_index.find(secs)]->getStateInto(secs, pos, vel, acc);
+}
+
+/*====== END RUNNERS =========*/
+
+}  // namespace sun